@@ -0,0 +1,238 @@
+/** Copyright 2026 Politecnico di Milano
+ * Developed by: Stefano Cherubin
+ * PhD student, Politecnico di Milano
+ * <first_name>.<family_name>@polimi.it
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIXED_POINT_ALGORITHM_HPP
+#define FIXED_POINT_ALGORITHM_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "fixed_point_traits.hpp"
+#include "fixed_point_parallel.hpp"
+
+namespace fxp {
+
+//-----------------------------------------------------------------------------
+// ORDER PRESERVING KEYS
+//-----------------------------------------------------------------------------
+
+/// Map a fixed-point value to an unsigned integer with the same ordering
+/** The raw value of signed types is two's complement, flipping its sign bit
+ *  moves negative numbers below the positive ones. */
+template <typename T>
+typename fixed_point_traits<T>::uraw_t radix_key(const T& value)
+{
+	typedef fixed_point_traits<T> traits;
+	typedef typename traits::uraw_t uraw_t;
+	uraw_t key = static_cast<uraw_t>(value.getRaw());
+	if (traits::is_signed) {
+		key ^= static_cast<uraw_t>(static_cast<uraw_t>(1) << (sizeof(uraw_t) * 8 - 1));
+	}
+	return key;
+}
+
+/// Inverse of radix_key
+template <typename T>
+T from_radix_key(typename fixed_point_traits<T>::uraw_t key)
+{
+	typedef fixed_point_traits<T> traits;
+	typedef typename traits::uraw_t uraw_t;
+	typedef typename traits::raw_t raw_t;
+	if (traits::is_signed) {
+		key ^= static_cast<uraw_t>(static_cast<uraw_t>(1) << (sizeof(uraw_t) * 8 - 1));
+	}
+	return T::createRaw(static_cast<raw_t>(key));
+}
+
+//-----------------------------------------------------------------------------
+// SORTING
+//-----------------------------------------------------------------------------
+
+/// Sort fixed-point values in ascending order
+/** LSD radix sort on 8 bit digits of the raw value: sizeof(raw_t) passes at
+ *  most, a pass is skipped when every key has the same digit. Each pass is
+ *  split among the available threads, every thread counts the digits of its
+ *  own chunk and then scatters the chunk in order, so the sort is stable.
+ *  Requires 2 * n * sizeof(raw_t) bytes of scratch memory. */
+template <typename T>
+void radix_sort(T* data, std::size_t n)
+{
+	typedef typename fixed_point_traits<T>::uraw_t uraw_t;
+	const unsigned radix = 256;
+	const unsigned passes = sizeof(uraw_t);
+	if (n < 2) {
+		return;
+	}
+	const std::size_t chunks = chunk_count(n);
+	std::vector<uraw_t> keys(n);
+	std::vector<uraw_t> scratch(n);
+	std::vector<std::size_t> counts(chunks * radix);
+
+	parallel_chunks(n, chunks, [&](std::size_t, std::size_t begin, std::size_t end) {
+		for (std::size_t i = begin; i < end; ++i) {
+			keys[i] = radix_key(data[i]);
+		}
+	});
+
+	uraw_t* src = keys.data();
+	uraw_t* dst = scratch.data();
+	for (unsigned pass = 0; pass < passes; ++pass) {
+		const unsigned shift = pass * 8;
+		std::fill(counts.begin(), counts.end(), 0);
+		parallel_chunks(n, chunks, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+			std::size_t* count = &counts[chunk * radix];
+			for (std::size_t i = begin; i < end; ++i) {
+				++count[static_cast<unsigned>(src[i] >> shift) & (radix - 1)];
+			}
+		});
+
+		// turn the counts into scatter offsets, digit major then chunk
+		bool trivial = false;
+		std::size_t offset = 0;
+		for (unsigned digit = 0; digit < radix; ++digit) {
+			const std::size_t first = offset;
+			for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+				const std::size_t count = counts[chunk * radix + digit];
+				counts[chunk * radix + digit] = offset;
+				offset += count;
+			}
+			trivial = trivial || (offset - first == n);
+		}
+		if (trivial) {
+			continue;
+		}
+
+		parallel_chunks(n, chunks, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+			std::size_t* position = &counts[chunk * radix];
+			for (std::size_t i = begin; i < end; ++i) {
+				const uraw_t key = src[i];
+				dst[position[static_cast<unsigned>(key >> shift) & (radix - 1)]++] = key;
+			}
+		});
+		std::swap(src, dst);
+	}
+
+	parallel_chunks(n, chunks, [&](std::size_t, std::size_t begin, std::size_t end) {
+		for (std::size_t i = begin; i < end; ++i) {
+			data[i] = from_radix_key<T>(src[i]);
+		}
+	});
+}
+
+//-----------------------------------------------------------------------------
+// PREFIX SUM
+//-----------------------------------------------------------------------------
+
+/// Running sum: out[i] = in[0] + ... + in[i]
+/** The sum wraps around as operator+ does. Large inputs are scanned in two
+ *  parallel passes: chunk totals first, then each chunk is scanned starting
+ *  from the sum of the chunks before it. in and out may be the same array. */
+template <typename T>
+void inclusive_scan(const T* in, T* out, std::size_t n)
+{
+	typedef fixed_point_traits<T> traits;
+	typedef typename traits::raw_t raw_t;
+	typedef typename traits::uraw_t uraw_t;
+	const std::size_t chunks = chunk_count(n);
+	std::vector<uraw_t> partial(chunks, 0);
+
+	if (chunks > 1) {
+		parallel_chunks(n, chunks, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+			uraw_t sum = 0;
+			for (std::size_t i = begin; i < end; ++i) {
+				sum += static_cast<uraw_t>(in[i].getRaw());
+			}
+			partial[chunk] = sum;
+		});
+		uraw_t carry = 0;
+		for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+			const uraw_t sum = partial[chunk];
+			partial[chunk] = carry;
+			carry += sum;
+		}
+	}
+
+	parallel_chunks(n, chunks, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+		uraw_t sum = partial[chunk];
+		for (std::size_t i = begin; i < end; ++i) {
+			sum += static_cast<uraw_t>(in[i].getRaw());
+			out[i] = T::createRaw(static_cast<raw_t>(sum));
+		}
+	});
+}
+
+//-----------------------------------------------------------------------------
+// HISTOGRAM
+//-----------------------------------------------------------------------------
+
+/// Count how many values fall in each bin of [low, high)
+/** \param counts Array of bins elements, overwritten with the result
+ *
+ *  Bins are step = ceil((high - low) / bins) raw units wide, the last one may
+ *  be narrower. A power of two step turns the bin lookup into a shift.
+ *  Values out of [low, high) are not counted. */
+template <typename T>
+void histogram(const T* data, std::size_t n, const T& low, const T& high,
+	std::size_t bins, std::size_t* counts)
+{
+	typedef typename fixed_point_traits<T>::uraw_t uraw_t;
+	std::fill(counts, counts + bins, 0);
+	const uraw_t first = radix_key(low);
+	const uraw_t last = radix_key(high);
+	if (bins == 0 || last <= first) {
+		return;
+	}
+	const uraw_t width = last - first;
+	uraw_t step = 1;
+	if (static_cast<uraw_t>(bins) == bins && static_cast<uraw_t>(bins) < width) {
+		step = (width - 1) / static_cast<uraw_t>(bins) + 1;
+	}
+	unsigned shift = 0;
+	while ((static_cast<uraw_t>(1) << shift) < step && shift < sizeof(uraw_t) * 8 - 1) {
+		++shift;
+	}
+	const bool pow2 = (static_cast<uraw_t>(1) << shift) == step;
+
+	const std::size_t chunks = chunk_count(n);
+	std::vector<std::size_t> local(chunks * bins, 0);
+	parallel_chunks(n, chunks, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+		std::size_t* count = &local[chunk * bins];
+		for (std::size_t i = begin; i < end; ++i) {
+			const uraw_t offset = radix_key(data[i]) - first;
+			if (offset < width) {
+				++count[static_cast<std::size_t>(pow2 ? offset >> shift : offset / step)];
+			}
+		}
+	});
+	for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+		for (std::size_t bin = 0; bin < bins; ++bin) {
+			counts[bin] += local[chunk * bins + bin];
+		}
+	}
+}
+
+} // namespace fxp
+
+#endif /* end of include guard: FIXED_POINT_ALGORITHM_HPP */
@@ -0,0 +1,460 @@
+/** Copyright 2026 Politecnico di Milano
+ * Developed by: Stefano Cherubin
+ * PhD student, Politecnico di Milano
+ * <first_name>.<family_name>@polimi.it
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIXED_POINT_ARRAY_HPP
+#define FIXED_POINT_ARRAY_HPP
+
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "fixed_point_buffer.hpp"
+#include "fixed_point_parallel.hpp"
+#include "fixed_point_traits.hpp"
+
+namespace fxp {
+
+//-----------------------------------------------------------------------------
+// EXPRESSION NODES
+//-----------------------------------------------------------------------------
+
+// Arithmetic on arrays builds a tree of expression nodes, evaluated element
+// by element when assigned to an array: out[i] = a[i] * b[i] + c[i] is one
+// loop reading a, b and c once, instead of one loop and one temporary array
+// per operator. Nodes hold leaves by pointer, so an expression must not
+// outlive the arrays it reads; assign it within the same statement.
+//
+// Every node has a value_t, the type of its elements, a size() and an
+// operator[] computing one element; the arrays combined by an operation must
+// have the same size. Intermediate values follow the operators of the
+// element types (the format of the left operand), unless the
+// expression is passed to exact(), which widens every sum, difference and
+// product of two fixed-point values in it, and in the operations combining
+// it with other expressions, to the format holding the exact result.
+
+/// Base of the expression nodes, E being the node type
+template <typename E>
+struct array_expr
+{
+	const E& self() const { return static_cast<const E&>(*this); }
+};
+
+/// Leaf node reading an existing array
+template <typename T, bool EXACT = false>
+struct array_ref : array_expr< array_ref<T, EXACT> >
+{
+	typedef T value_t;
+	static const bool exact = EXACT;
+
+	const T* data;
+	std::size_t n;
+
+	array_ref(const T* data, std::size_t n) : data(data), n(n) {}
+
+	std::size_t size() const { return n; }
+	T operator[](std::size_t i) const { return data[i]; }
+};
+
+/// Leaf node repeating a value, for operations with a scalar
+template <typename S>
+struct scalar_expr : array_expr< scalar_expr<S> >
+{
+	typedef S value_t;
+	static const bool exact = false;
+
+	S value;
+
+	explicit scalar_expr(const S& value) : value(value) {}
+
+	std::size_t size() const { return std::numeric_limits<std::size_t>::max(); }
+	S operator[](std::size_t) const { return value; }
+};
+
+/// Node applying Op to the elements of L and R
+template <typename Op, typename L, typename R>
+struct binary_expr : array_expr< binary_expr<Op, L, R> >
+{
+	typedef typename L::value_t left_t;
+	typedef typename R::value_t right_t;
+
+	/// Exact widening only applies between two fixed-point values
+	static const bool exact = (L::exact || R::exact)
+		&& fixed_point_traits<left_t>::is_fixed_point && fixed_point_traits<right_t>::is_fixed_point;
+	typedef std::integral_constant<bool, exact> exact_tag;
+
+	typedef decltype(Op::apply(std::declval<left_t>(), std::declval<right_t>(), exact_tag())) value_t;
+
+	L left;
+	R right;
+
+	/// Throws std::invalid_argument when both operands are arrays of different sizes
+	binary_expr(const L& left, const R& right) : left(left), right(right) {
+		const std::size_t scalar = std::numeric_limits<std::size_t>::max();
+		if (left.size() != right.size() && left.size() != scalar && right.size() != scalar) {
+			throw std::invalid_argument("fxp::array: operands of different sizes");
+		}
+	}
+
+	/// Size of the array operand, scalars having the largest size
+	std::size_t size() const { return left.size() < right.size() ? left.size() : right.size(); }
+	value_t operator[](std::size_t i) const { return Op::apply(left[i], right[i], exact_tag()); }
+};
+
+/// Node applying Op to the elements of E
+template <typename Op, typename E>
+struct unary_expr : array_expr< unary_expr<Op, E> >
+{
+	typedef decltype(Op::apply(std::declval<typename E::value_t>())) value_t;
+	static const bool exact = E::exact;
+
+	E arg;
+
+	explicit unary_expr(const E& arg) : arg(arg) {}
+
+	std::size_t size() const { return arg.size(); }
+	value_t operator[](std::size_t i) const { return Op::apply(arg[i]); }
+};
+
+/// Node converting the elements of E to the format T
+template <typename T, typename E>
+struct cast_expr : array_expr< cast_expr<T, E> >
+{
+	typedef T value_t;
+	static const bool exact = E::exact;
+
+	E arg;
+
+	explicit cast_expr(const E& arg) : arg(arg) {}
+
+	std::size_t size() const { return arg.size(); }
+	T operator[](std::size_t i) const { return convert_to<T>(arg[i]); }
+};
+
+//-----------------------------------------------------------------------------
+// ELEMENT OPERATIONS
+//-----------------------------------------------------------------------------
+
+struct plus_op {
+	template <typename A, typename B>
+	static auto apply(const A& a, const B& b, std::false_type) -> decltype(a + b) { return a + b; }
+
+	template <typename A, typename B>
+	static typename sum_format<A, B>::RESULT apply(const A& a, const B& b, std::true_type) {
+		typedef typename sum_format<A, B>::RESULT result_t;
+		return convert_to<result_t>(a) + convert_to<result_t>(b);
+	}
+};
+
+struct minus_op {
+	template <typename A, typename B>
+	static auto apply(const A& a, const B& b, std::false_type) -> decltype(a - b) { return a - b; }
+
+	template <typename A, typename B>
+	static typename sum_format<A, B, true>::RESULT apply(const A& a, const B& b, std::true_type) {
+		typedef typename sum_format<A, B, true>::RESULT result_t;
+		return convert_to<result_t>(a) - convert_to<result_t>(b);
+	}
+};
+
+struct multiplies_op {
+	template <typename A, typename B>
+	static auto apply(const A& a, const B& b, std::false_type) -> decltype(a * b) { return a * b; }
+
+	template <typename A, typename B>
+	static typename product_format<A, B>::RESULT apply(const A& a, const B& b, std::true_type) {
+		return multiply_to<typename product_format<A, B>::RESULT>(a, b);
+	}
+};
+
+/// Quotients have no exact format, exact() leaves them to operator/
+struct divides_op {
+	template <typename A, typename B, typename EXACT>
+	static auto apply(const A& a, const B& b, EXACT) -> decltype(a / b) { return a / b; }
+};
+
+struct shift_left_op {
+	template <typename A, typename B, typename EXACT>
+	static auto apply(const A& a, const B& b, EXACT) -> decltype(a << b) { return a << b; }
+};
+
+struct shift_right_op {
+	template <typename A, typename B, typename EXACT>
+	static auto apply(const A& a, const B& b, EXACT) -> decltype(a >> b) { return a >> b; }
+};
+
+struct negate_op {
+	template <typename A>
+	static auto apply(const A& a) -> decltype(-a) { return -a; }
+};
+
+//-----------------------------------------------------------------------------
+// ARRAY
+//-----------------------------------------------------------------------------
+
+/// Contiguous array of fixed-point values with lazy element-wise arithmetic
+/** Assigning an expression evaluates it in a single pass, split among the
+ *  threads of fixed_point_parallel.hpp when larger than default_grain and
+ *  written so that the compiler vectorises the loop of each thread. The
+ *  elements are converted to T as by convert_to. An expression may read the
+ *  array it is assigned to, as each element only depends on the elements
+ *  with the same index.
+ *
+ *  Example: out = a * b + c; wide = exact(a * b) + c; */
+template <typename T>
+class array : public array_expr< array<T> >
+{
+	static_assert(fixed_point_traits<T>::is_fixed_point, "fxp::array holds fixed-point values");
+
+public:
+	typedef T value_t;
+	static const bool exact = false;
+
+	array() {}
+
+	/// Array of n zeros
+	explicit array(std::size_t n) : values(n) {}
+
+	array(std::size_t n, const T& value) : values(n, value) {}
+
+	array(const T* first, std::size_t n) : values(first, n) {}
+
+	template <typename E>
+	array(const array_expr<E>& expr) { assign(expr); }
+
+	template <typename E>
+	array& operator=(const array_expr<E>& expr) {
+		assign(expr);
+		return *this;
+	}
+
+	/// Evaluate expr into the array, resized to the size of expr
+	/** \param grain Minimum number of elements per thread */
+	template <typename E>
+	void assign(const array_expr<E>& expr, std::size_t grain = default_grain) {
+		const std::size_t n = expr.self().size();
+		if (n == values.size()) {
+			evaluate(values.data(), expr, grain);
+		} else {
+			// expr may read the old storage
+			buffer<T> result(n);
+			evaluate(result.data(), expr, grain);
+			values.swap(result);
+		}
+	}
+
+	template <typename E> array& operator+=(const E& value) { return *this = *this + value; }
+	template <typename E> array& operator-=(const E& value) { return *this = *this - value; }
+	template <typename E> array& operator*=(const E& value) { return *this = *this * value; }
+	template <typename E> array& operator/=(const E& value) { return *this = *this / value; }
+
+	std::size_t size() const { return values.size(); }
+	bool empty() const { return values.empty(); }
+	void resize(std::size_t n) { values.resize(n); }
+
+	T* data() { return values.data(); }
+	const T* data() const { return values.data(); }
+
+	T* begin() { return values.data(); }
+	T* end() { return values.data() + values.size(); }
+	const T* begin() const { return values.data(); }
+	const T* end() const { return values.data() + values.size(); }
+
+	T& operator[](std::size_t i) { return values[i]; }
+	const T& operator[](std::size_t i) const { return values[i]; }
+
+private:
+	/// Aligned and padded, so evaluation loops start on a vector boundary
+	buffer<T> values;
+};
+
+//-----------------------------------------------------------------------------
+// EVALUATION
+//-----------------------------------------------------------------------------
+
+/// out[i] = expr[i] for i in [begin, end), converted to T
+template <typename T, typename E>
+void evaluate_range(T* out, const E& expr, std::size_t begin, std::size_t end)
+{
+	const E e = expr;
+	_FIXED_POINT_IVDEP_
+	for (std::size_t i = begin; i < end; ++i) {
+		out[i] = convert_to<T>(e[i]);
+	}
+}
+
+/// out[i] = expr[i] for every element of expr, converted to T
+/** out may be one of the arrays read by expr, but must not overlap another
+ *  one. \param grain Minimum number of elements per thread */
+template <typename T, typename E>
+void evaluate(T* out, const array_expr<E>& expr, std::size_t grain = default_grain)
+{
+	const E& e = expr.self();
+	parallel_for(e.size(), [out, &e](std::size_t begin, std::size_t end) {
+		evaluate_range(out, e, begin, end);
+	}, grain);
+}
+
+//-----------------------------------------------------------------------------
+// EXPRESSION BUILDERS
+//-----------------------------------------------------------------------------
+
+/// Node type storing the expression E: arrays are read through an array_ref
+template <typename E>
+struct expr_leaf
+{
+	typedef E type;
+	static const E& make(const E& e) { return e; }
+};
+
+template <typename T>
+struct expr_leaf< array<T> >
+{
+	typedef array_ref<T> type;
+	static type make(const array<T>& a) { return type(a.data(), a.size()); }
+};
+
+template <typename T>
+struct is_array_expr : std::is_base_of<array_expr<T>, T> {};
+
+/// Expression reading n values at data, which must outlive it
+template <typename T>
+array_ref<T> view(const T* data, std::size_t n)
+{
+	return array_ref<T>(data, n);
+}
+
+/// Same expression with every node marked for exact widening
+template <typename E>
+struct exact_tree
+{
+	typedef E type;
+	static const E& make(const E& e) { return e; }
+};
+
+template <typename T, bool EXACT>
+struct exact_tree< array_ref<T, EXACT> >
+{
+	typedef array_ref<T, true> type;
+	static type make(const array_ref<T, EXACT>& e) { return type(e.data, e.n); }
+};
+
+template <typename T>
+struct exact_tree< array<T> >
+{
+	typedef array_ref<T, true> type;
+	static type make(const array<T>& a) { return type(a.data(), a.size()); }
+};
+
+template <typename Op, typename L, typename R>
+struct exact_tree< binary_expr<Op, L, R> >
+{
+	typedef binary_expr<Op, typename exact_tree<L>::type, typename exact_tree<R>::type> type;
+	static type make(const binary_expr<Op, L, R>& e) {
+		return type(exact_tree<L>::make(e.left), exact_tree<R>::make(e.right));
+	}
+};
+
+template <typename Op, typename E>
+struct exact_tree< unary_expr<Op, E> >
+{
+	typedef unary_expr<Op, typename exact_tree<E>::type> type;
+	static type make(const unary_expr<Op, E>& e) { return type(exact_tree<E>::make(e.arg)); }
+};
+
+template <typename T, typename E>
+struct exact_tree< cast_expr<T, E> >
+{
+	typedef cast_expr<T, typename exact_tree<E>::type> type;
+	static type make(const cast_expr<T, E>& e) { return type(exact_tree<E>::make(e.arg)); }
+};
+
+/// Widen every sum, difference and product of expr to its exact format
+/** Operations combining the result with other expressions are exact too. */
+template <typename E>
+typename exact_tree<E>::type exact(const array_expr<E>& expr)
+{
+	return exact_tree<E>::make(expr.self());
+}
+
+/// Convert the elements of expr to the format T
+template <typename T, typename E>
+cast_expr<T, typename expr_leaf<E>::type> cast(const array_expr<E>& expr)
+{
+	return cast_expr<T, typename expr_leaf<E>::type>(expr_leaf<E>::make(expr.self()));
+}
+
+template <typename E>
+unary_expr<negate_op, typename expr_leaf<E>::type> operator-(const array_expr<E>& expr)
+{
+	return unary_expr<negate_op, typename expr_leaf<E>::type>(expr_leaf<E>::make(expr.self()));
+}
+
+// Binary operators between two expressions, an expression and a scalar, and
+// for the commutative ones a scalar and an expression, which swaps the
+// operands so that the elements keep the format of the array
+#define _FIXED_POINT_ARRAY_OPERATOR_(OP, OP_T)                                          \
+template <typename L, typename R>                                                       \
+binary_expr<OP_T, typename expr_leaf<L>::type, typename expr_leaf<R>::type>             \
+operator OP(const array_expr<L>& left, const array_expr<R>& right)                      \
+{                                                                                       \
+	return binary_expr<OP_T, typename expr_leaf<L>::type, typename expr_leaf<R>::type>( \
+		expr_leaf<L>::make(left.self()), expr_leaf<R>::make(right.self()));             \
+}                                                                                       \
+                                                                                        \
+template <typename L, typename S>                                                       \
+typename std::enable_if<!is_array_expr<S>::value,                                       \
+	binary_expr<OP_T, typename expr_leaf<L>::type, scalar_expr<S> > >::type             \
+operator OP(const array_expr<L>& left, const S& right)                                  \
+{                                                                                       \
+	return binary_expr<OP_T, typename expr_leaf<L>::type, scalar_expr<S> >(             \
+		expr_leaf<L>::make(left.self()), scalar_expr<S>(right));                        \
+}
+
+#define _FIXED_POINT_ARRAY_COMMUTATIVE_OPERATOR_(OP, OP_T)                              \
+_FIXED_POINT_ARRAY_OPERATOR_(OP, OP_T)                                                  \
+                                                                                        \
+template <typename S, typename R>                                                       \
+typename std::enable_if<!is_array_expr<S>::value,                                       \
+	binary_expr<OP_T, typename expr_leaf<R>::type, scalar_expr<S> > >::type             \
+operator OP(const S& left, const array_expr<R>& right)                                  \
+{                                                                                       \
+	return binary_expr<OP_T, typename expr_leaf<R>::type, scalar_expr<S> >(             \
+		expr_leaf<R>::make(right.self()), scalar_expr<S>(left));                        \
+}
+
+_FIXED_POINT_ARRAY_COMMUTATIVE_OPERATOR_(+, plus_op)
+_FIXED_POINT_ARRAY_OPERATOR_(-, minus_op)
+_FIXED_POINT_ARRAY_COMMUTATIVE_OPERATOR_(*, multiplies_op)
+_FIXED_POINT_ARRAY_OPERATOR_(/, divides_op)
+_FIXED_POINT_ARRAY_OPERATOR_(<<, shift_left_op)
+_FIXED_POINT_ARRAY_OPERATOR_(>>, shift_right_op)
+
+#undef _FIXED_POINT_ARRAY_COMMUTATIVE_OPERATOR_
+#undef _FIXED_POINT_ARRAY_OPERATOR_
+
+} // namespace fxp
+
+#endif /* end of include guard: FIXED_POINT_ARRAY_HPP */
@@ -0,0 +1,363 @@
+/** Copyright 2026 Politecnico di Milano
+ * Developed by: Stefano Cherubin
+ * PhD student, Politecnico di Milano
+ * <first_name>.<family_name>@polimi.it
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIXED_POINT_ATOMIC_HPP
+#define FIXED_POINT_ATOMIC_HPP
+
+#include <atomic>
+
+#include "fixed_point_traits.hpp"
+
+namespace fxp {
+
+//-----------------------------------------------------------------------------
+// ATOMIC RAW STORAGE
+//-----------------------------------------------------------------------------
+
+/// Atomic storage for the raw value of a fixed-point number
+/** Up to 64 bits the storage is a plain std::atomic over raw_t, whose
+ *  fetch_add and fetch_sub map to a single locked instruction. */
+template <typename raw_t>
+struct atomic_storage
+{
+	std::atomic<raw_t> data;
+
+	atomic_storage() : data(0) {}
+
+	raw_t load(std::memory_order order) const {
+		return data.load(order);
+	}
+
+	void store(raw_t value, std::memory_order order) {
+		data.store(value, order);
+	}
+
+	raw_t exchange(raw_t value, std::memory_order order) {
+		return data.exchange(value, order);
+	}
+
+	bool compare_exchange_weak(raw_t& expected, raw_t desired, std::memory_order order) {
+		return data.compare_exchange_weak(expected, desired, order);
+	}
+
+	bool compare_exchange_strong(raw_t& expected, raw_t desired, std::memory_order order) {
+		return data.compare_exchange_strong(expected, desired, order);
+	}
+
+	raw_t fetch_add(raw_t value, std::memory_order order) {
+		return data.fetch_add(value, order);
+	}
+
+	raw_t fetch_sub(raw_t value, std::memory_order order) {
+		return data.fetch_sub(value, order);
+	}
+
+	bool is_lock_free() const {
+		return data.is_lock_free();
+	}
+};
+
+#ifdef _IS64bit
+
+/// 128 bit atomic storage
+/** std::atomic does not provide arithmetic on 128 bit integers, so every
+ *  operation is a compare-and-swap loop on the whole 16 byte word. When
+ *  compiling with -mcx16 the CAS is an inlined cmpxchg16b, which always acts
+ *  as a full barrier, hence the requested memory order is only a lower bound.
+ *  Otherwise std::atomic is used, which requires linking libatomic. */
+template <typename raw_t, typename uraw_t>
+struct atomic_storage_wide
+{
+#ifdef __GCC_HAVE_SYNC_COMPARE_AND_SWAP_16
+	alignas(16) mutable volatile raw_t data;
+
+	atomic_storage_wide() : data(0) {}
+
+	raw_t load(std::memory_order) const {
+		// a CAS which replaces 0 with 0 reads the current value atomically
+		return __sync_val_compare_and_swap(&data, static_cast<raw_t>(0), static_cast<raw_t>(0));
+	}
+
+	bool compare_exchange_strong(raw_t& expected, raw_t desired, std::memory_order) {
+		const raw_t previous = __sync_val_compare_and_swap(&data, expected, desired);
+		if (previous == expected) {
+			return true;
+		}
+		expected = previous;
+		return false;
+	}
+
+	bool is_lock_free() const {
+		return true;
+	}
+#else
+	std::atomic<raw_t> data;
+
+	atomic_storage_wide() : data(0) {}
+
+	raw_t load(std::memory_order order) const {
+		return data.load(order);
+	}
+
+	bool compare_exchange_strong(raw_t& expected, raw_t desired, std::memory_order order) {
+		return data.compare_exchange_strong(expected, desired, order);
+	}
+
+	bool is_lock_free() const {
+		return data.is_lock_free();
+	}
+#endif
+
+	bool compare_exchange_weak(raw_t& expected, raw_t desired, std::memory_order order) {
+		return compare_exchange_strong(expected, desired, order);
+	}
+
+	void store(raw_t value, std::memory_order order) {
+		exchange(value, order);
+	}
+
+	raw_t exchange(raw_t value, std::memory_order order) {
+		raw_t expected = load(std::memory_order_relaxed);
+		while (!compare_exchange_strong(expected, value, order)) {}
+		return expected;
+	}
+
+	raw_t fetch_add(raw_t value, std::memory_order order) {
+		raw_t expected = load(std::memory_order_relaxed);
+		while (!compare_exchange_strong(expected,
+			static_cast<raw_t>(static_cast<uraw_t>(expected) + static_cast<uraw_t>(value)), order)) {}
+		return expected;
+	}
+
+	raw_t fetch_sub(raw_t value, std::memory_order order) {
+		raw_t expected = load(std::memory_order_relaxed);
+		while (!compare_exchange_strong(expected,
+			static_cast<raw_t>(static_cast<uraw_t>(expected) - static_cast<uraw_t>(value)), order)) {}
+		return expected;
+	}
+};
+
+template <>
+struct atomic_storage<__int128> : public atomic_storage_wide<__int128, __uint128_t> {};
+
+template <>
+struct atomic_storage<__uint128_t> : public atomic_storage_wide<__uint128_t, __uint128_t> {};
+
+#endif
+
+//-----------------------------------------------------------------------------
+// ATOMIC FIXED-POINT
+//-----------------------------------------------------------------------------
+
+/// Atomic fixed-point number
+/** \tparam T Either a fixed_point_t or a ufixed_point_t
+ *
+ *  Plain fetch_add and fetch_sub wrap around like the arithmetic operators of
+ *  T do. The saturating variants clamp the result to the range of T and are
+ *  implemented as a compare-and-swap loop.
+ */
+template <typename T>
+class atomic
+{
+	typedef fixed_point_traits<T> traits;
+	typedef typename traits::raw_t raw_t;
+
+	atomic_storage<raw_t> storage;
+
+public:
+	typedef T value_type;
+
+	atomic() {}
+
+	explicit atomic(const T& value) {
+		storage.store(value.getRaw(), std::memory_order_relaxed);
+	}
+
+	atomic(const atomic&) = delete;
+	atomic& operator=(const atomic&) = delete;
+
+	bool is_lock_free() const {
+		return storage.is_lock_free();
+	}
+
+	T load(std::memory_order order = std::memory_order_seq_cst) const {
+		return T::createRaw(storage.load(order));
+	}
+
+	void store(const T& value, std::memory_order order = std::memory_order_seq_cst) {
+		storage.store(value.getRaw(), order);
+	}
+
+	T exchange(const T& value, std::memory_order order = std::memory_order_seq_cst) {
+		return T::createRaw(storage.exchange(value.getRaw(), order));
+	}
+
+	bool compare_exchange_weak(T& expected, const T& desired,
+		std::memory_order order = std::memory_order_seq_cst)
+	{
+		raw_t expected_raw = expected.getRaw();
+		const bool res = storage.compare_exchange_weak(expected_raw, desired.getRaw(), order);
+		expected = T::createRaw(expected_raw);
+		return res;
+	}
+
+	bool compare_exchange_strong(T& expected, const T& desired,
+		std::memory_order order = std::memory_order_seq_cst)
+	{
+		raw_t expected_raw = expected.getRaw();
+		const bool res = storage.compare_exchange_strong(expected_raw, desired.getRaw(), order);
+		expected = T::createRaw(expected_raw);
+		return res;
+	}
+
+	/// Add value and return the previous content
+	T fetch_add(const T& value, std::memory_order order = std::memory_order_seq_cst) {
+		return T::createRaw(storage.fetch_add(value.getRaw(), order));
+	}
+
+	/// Subtract value and return the previous content
+	T fetch_sub(const T& value, std::memory_order order = std::memory_order_seq_cst) {
+		return T::createRaw(storage.fetch_sub(value.getRaw(), order));
+	}
+
+	/// Add value clamping to the range of T, return the previous content
+	T fetch_add_saturate(const T& value, std::memory_order order = std::memory_order_seq_cst) {
+		raw_t expected = storage.load(std::memory_order_relaxed);
+		while (!storage.compare_exchange_weak(expected,
+			saturate_add<T>(expected, value.getRaw()), order)) {}
+		return T::createRaw(expected);
+	}
+
+	/// Subtract value clamping to the range of T, return the previous content
+	T fetch_sub_saturate(const T& value, std::memory_order order = std::memory_order_seq_cst) {
+		raw_t expected = storage.load(std::memory_order_relaxed);
+		while (!storage.compare_exchange_weak(expected,
+			saturate_sub<T>(expected, value.getRaw()), order)) {}
+		return T::createRaw(expected);
+	}
+
+	T operator=(const T& value) {
+		store(value);
+		return value;
+	}
+
+	operator T() const {
+		return load();
+	}
+
+	T operator+=(const T& value) {
+		return fetch_add(value) + value;
+	}
+
+	T operator-=(const T& value) {
+		return fetch_sub(value) - value;
+	}
+};
+
+//-----------------------------------------------------------------------------
+// SHARDED ACCUMULATOR
+//-----------------------------------------------------------------------------
+
+/// Contention-free accumulator for fixed-point totals
+/** \tparam T Either a fixed_point_t or a ufixed_point_t
+ *  \tparam SHARDS Number of partial sums, each one on its own cache line
+ *
+ *  Each thread is bound to one shard the first time it touches a sharded
+ *  accumulator of a given T and SHARDS, threads being dealt to shards in
+ *  round-robin order; the counter and the binding belong to the template
+ *  instantiation, so one thread may use different shards in accumulators of
+ *  different types. Updates are relaxed atomic additions on the own shard;
+ *  the partial sums are combined only when the total is read, hence load()
+ *  is O(SHARDS) and is not a snapshot of concurrent updates.
+ */
+template <typename T, unsigned SHARDS = 16>
+class sharded_accumulator
+{
+	typedef fixed_point_traits<T> traits;
+	typedef typename traits::raw_t raw_t;
+	typedef typename traits::uraw_t uraw_t;
+
+	struct alignas(cache_line_size) shard_t {
+		atomic_storage<raw_t> partial;
+	};
+
+	shard_t shards[SHARDS];
+
+	static unsigned shard_index() {
+		static std::atomic<unsigned> next_slot(0);
+		static thread_local unsigned slot = next_slot.fetch_add(1, std::memory_order_relaxed);
+		return slot % SHARDS;
+	}
+
+public:
+	typedef T value_type;
+
+	sharded_accumulator() {}
+
+	sharded_accumulator(const sharded_accumulator&) = delete;
+	sharded_accumulator& operator=(const sharded_accumulator&) = delete;
+
+	void add(const T& value) {
+		shards[shard_index()].partial.fetch_add(value.getRaw(), std::memory_order_relaxed);
+	}
+
+	void sub(const T& value) {
+		shards[shard_index()].partial.fetch_sub(value.getRaw(), std::memory_order_relaxed);
+	}
+
+	sharded_accumulator& operator+=(const T& value) {
+		add(value);
+		return *this;
+	}
+
+	sharded_accumulator& operator-=(const T& value) {
+		sub(value);
+		return *this;
+	}
+
+	/// Combine the partial sums
+	T load() const {
+		uraw_t total = 0;
+		for (unsigned i = 0; i < SHARDS; ++i) {
+			total += static_cast<uraw_t>(shards[i].partial.load(std::memory_order_relaxed));
+		}
+		return T::createRaw(static_cast<raw_t>(total));
+	}
+
+	operator T() const {
+		return load();
+	}
+
+	/// Clear every partial sum
+	/** \warning Not atomic with respect to concurrent updates */
+	void reset() {
+		for (unsigned i = 0; i < SHARDS; ++i) {
+			shards[i].partial.store(0, std::memory_order_relaxed);
+		}
+	}
+};
+
+} // namespace fxp
+
+#endif /* end of include guard: FIXED_POINT_ATOMIC_HPP */
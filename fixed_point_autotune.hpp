@@ -0,0 +1,343 @@
+/** Copyright 2026 Politecnico di Milano
+ * Developed by: Stefano Cherubin
+ * PhD student, Politecnico di Milano
+ * <first_name>.<family_name>@polimi.it
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIXED_POINT_AUTOTUNE_HPP
+#define FIXED_POINT_AUTOTUNE_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "fixed_point.hpp"
+#include "fixed_point_parallel.hpp"
+
+namespace fxp {
+
+//-----------------------------------------------------------------------------
+// CANDIDATE FORMATS
+//-----------------------------------------------------------------------------
+
+/// A candidate fixed_point_t<INT_BITS, FRAC_BITS> format
+template <uint16_t INT_BITS, uint16_t FRAC_BITS>
+struct format
+{
+	typedef fixed_point_t<INT_BITS, FRAC_BITS> RESULT;
+};
+
+/// A compile-time list of candidate formats
+template <typename... Formats>
+struct format_list {};
+
+/// Concatenation of two format lists
+template <typename L1, typename L2>
+struct concat_formats;
+
+template <typename... F1, typename... F2>
+struct concat_formats< format_list<F1...>, format_list<F2...> >
+{
+	typedef format_list<F1..., F2...> RESULT;
+};
+
+template <uint16_t WIDTH, uint16_t INT_BITS, typename... Acc>
+struct make_formats_of_width
+{
+	typedef typename make_formats_of_width<WIDTH, INT_BITS - 1,
+		format<INT_BITS, WIDTH - INT_BITS>, Acc...>::RESULT RESULT;
+};
+
+template <uint16_t WIDTH, typename... Acc>
+struct make_formats_of_width<WIDTH, 0, Acc...>
+{
+	typedef format_list<Acc...> RESULT;
+};
+
+/// Every format with INT_BITS + FRAC_BITS == WIDTH and both parts non-empty
+template <uint16_t WIDTH>
+struct formats_of_width
+{
+	typedef typename make_formats_of_width<WIDTH, WIDTH - 1>::RESULT RESULT;
+};
+
+/// Every 8, 16 and 32 bit format
+/** 64 bit formats are left out since their products go through __int128 and
+ *  instantiating the kernel for each of them is slow to compile; add them
+ *  with concat_formats if needed. */
+typedef concat_formats<
+	formats_of_width<8>::RESULT,
+	concat_formats<formats_of_width<16>::RESULT, formats_of_width<32>::RESULT>::RESULT
+>::RESULT default_formats;
+
+//-----------------------------------------------------------------------------
+// EVALUATION
+//-----------------------------------------------------------------------------
+
+/// Outcome of the evaluation of a candidate format
+struct autotune_result
+{
+	uint16_t integer_bits;
+	uint16_t fractional_bits;
+	uint16_t bit_width;
+	/// Largest absolute error over the samples, with respect to long double
+	long double max_error;
+	/// Kernel evaluations per second, 0 if not measured
+	double throughput;
+	/// True if max_error is within the error budget
+	bool feasible;
+};
+
+/// Cheapest first: feasible, then narrower, then faster
+inline bool autotune_cheaper(const autotune_result& a, const autotune_result& b)
+{
+	if (a.feasible != b.feasible) {
+		return a.feasible;
+	}
+	if (a.bit_width != b.bit_width) {
+		return a.bit_width < b.bit_width;
+	}
+	if (a.throughput != b.throughput) {
+		return a.throughput > b.throughput;
+	}
+	return a.fractional_bits > b.fractional_bits;
+}
+
+/// Convert each sample to number_t, arity values per kernel evaluation
+template <typename number_t>
+std::vector<number_t> autotune_inputs(const double* samples, std::size_t count, unsigned arity)
+{
+	std::vector<number_t> inputs;
+	inputs.reserve(count * arity);
+	for (std::size_t i = 0; i < count * arity; ++i) {
+		inputs.push_back(number_t(samples[i]));
+	}
+	return inputs;
+}
+
+/// Largest absolute difference between the kernel on number_t and the reference
+template <typename number_t, typename Kernel>
+long double autotune_error(const Kernel& kernel, const double* samples,
+	std::size_t count, unsigned arity, const std::vector<long double>& reference)
+{
+	const std::vector<number_t> inputs = autotune_inputs<number_t>(samples, count, arity);
+	long double max_error = 0;
+	for (std::size_t i = 0; i < count; ++i) {
+		const number_t res = kernel(&inputs[i * arity]);
+		long double error = static_cast<long double>(res) - reference[i];
+		error = error < 0 ? -error : error;
+		// NaN and inf in the reference never compare greater
+		if (error > max_error || error != error) {
+			max_error = error;
+		}
+	}
+	return max_error;
+}
+
+/// Kernel evaluations per second on number_t, timed for at least min_seconds
+template <typename number_t, typename Kernel>
+double autotune_throughput(const Kernel& kernel, const double* samples,
+	std::size_t count, unsigned arity, double min_seconds)
+{
+	typedef std::chrono::steady_clock clock_t;
+	const std::vector<number_t> inputs = autotune_inputs<number_t>(samples, count, arity);
+	volatile typename number_t::raw_t sink = 0;
+	std::size_t runs = 0;
+	const clock_t::time_point start = clock_t::now();
+	double elapsed = 0;
+	do {
+		for (std::size_t i = 0; i < count; ++i) {
+			sink = kernel(&inputs[i * arity]).getRaw();
+		}
+		runs += count;
+		elapsed = std::chrono::duration<double>(clock_t::now() - start).count();
+	} while (elapsed < min_seconds);
+	(void)sink;
+	return runs / elapsed;
+}
+
+/// Type-erased evaluation of a candidate format
+struct autotune_candidate
+{
+	uint16_t integer_bits;
+	uint16_t fractional_bits;
+	std::function<long double()> error;
+	std::function<double()> throughput;
+};
+
+template <typename Kernel, uint16_t INT_BITS, uint16_t FRAC_BITS>
+autotune_candidate make_autotune_candidate(const Kernel& kernel, const double* samples,
+	std::size_t count, unsigned arity, const std::vector<long double>& reference,
+	double min_seconds, format<INT_BITS, FRAC_BITS>)
+{
+	typedef fixed_point_t<INT_BITS, FRAC_BITS> number_t;
+	autotune_candidate candidate;
+	candidate.integer_bits = INT_BITS;
+	candidate.fractional_bits = FRAC_BITS;
+	candidate.error = [&kernel, samples, count, arity, &reference]() {
+		return autotune_error<number_t>(kernel, samples, count, arity, reference);
+	};
+	candidate.throughput = [&kernel, samples, count, arity, min_seconds]() {
+		return autotune_throughput<number_t>(kernel, samples, count, arity, min_seconds);
+	};
+	return candidate;
+}
+
+/// Search the format list for the cheapest format meeting the error budget
+/** \param kernel Functor with a template call operator taking a pointer to
+ *   arity number_t inputs and returning number_t; it is instantiated for
+ *   long double, which is the reference, and for every candidate format
+ *  \param samples count * arity input values
+ *  \param budget Largest acceptable absolute error
+ *  \param min_seconds Minimum timing duration of each feasible format
+ *  \return Every candidate, cheapest first (see autotune_cheaper)
+ *
+ *  The error of every candidate is measured in parallel across the available
+ *  threads. Throughput is then timed one format at a time, and only for the
+ *  feasible formats of the narrowest feasible bit width, so that timings do
+ *  not compete for the cores. */
+template <typename Kernel, typename... Formats>
+std::vector<autotune_result> autotune(const Kernel& kernel, const double* samples,
+	std::size_t count, unsigned arity, long double budget,
+	format_list<Formats...>, double min_seconds = 0.05)
+{
+	const std::vector<long double> reference_inputs = autotune_inputs<long double>(samples, count, arity);
+	std::vector<long double> reference(count);
+	for (std::size_t i = 0; i < count; ++i) {
+		reference[i] = kernel(&reference_inputs[i * arity]);
+	}
+
+	const autotune_candidate candidates[] = {
+		make_autotune_candidate(kernel, samples, count, arity, reference, min_seconds, Formats())...
+	};
+	const std::size_t n = sizeof(candidates) / sizeof(candidates[0]);
+
+	std::vector<autotune_result> results(n);
+	parallel_for(n, [&](std::size_t begin, std::size_t end) {
+		for (std::size_t i = begin; i < end; ++i) {
+			autotune_result& res = results[i];
+			res.integer_bits = candidates[i].integer_bits;
+			res.fractional_bits = candidates[i].fractional_bits;
+			res.bit_width = res.integer_bits + res.fractional_bits;
+			res.max_error = candidates[i].error();
+			res.throughput = 0;
+			res.feasible = res.max_error <= budget;
+		}
+	}, 1);
+
+	uint16_t narrowest = 0;
+	for (std::size_t i = 0; i < n; ++i) {
+		if (results[i].feasible && (narrowest == 0 || results[i].bit_width < narrowest)) {
+			narrowest = results[i].bit_width;
+		}
+	}
+	for (std::size_t i = 0; i < n; ++i) {
+		if (results[i].feasible && results[i].bit_width == narrowest) {
+			results[i].throughput = candidates[i].throughput();
+		}
+	}
+
+	std::sort(results.begin(), results.end(), autotune_cheaper);
+	return results;
+}
+
+//-----------------------------------------------------------------------------
+// COMMAND LINE DRIVER
+//-----------------------------------------------------------------------------
+
+/// Entry point of an fxp_autotune command line tool for the given kernel
+/** Usage: fxp_autotune [--budget E] [--threads N] [--all] [FILE]
+ *
+ *  Reads whitespace separated samples, arity values per kernel evaluation,
+ *  from FILE or from the standard input, prints the cheapest format meeting
+ *  the budget (or every candidate with --all) and returns 0; returns 1 if no
+ *  candidate meets the budget and 2 on invalid input. A tool is built from
+ *  a one line main, e.g.
+ *
+ *    int main(int argc, char** argv) {
+ *      return fxp::autotune_main(argc, argv, my_kernel(), 2, fxp::default_formats());
+ *    }
+ */
+template <typename Kernel, typename... Formats>
+int autotune_main(int argc, char** argv, const Kernel& kernel, unsigned arity,
+	format_list<Formats...> formats)
+{
+	long double budget = 0;
+	bool all = false;
+	const char* path = 0;
+	for (int i = 1; i < argc; ++i) {
+		if (std::strcmp(argv[i], "--budget") == 0 && i + 1 < argc) {
+			budget = std::strtold(argv[++i], 0);
+		} else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+			set_thread_count(static_cast<unsigned>(std::strtoul(argv[++i], 0, 10)));
+		} else if (std::strcmp(argv[i], "--all") == 0) {
+			all = true;
+		} else if (argv[i][0] != '-' && path == 0) {
+			path = argv[i];
+		} else {
+			std::cerr << "usage: " << argv[0] << " [--budget E] [--threads N] [--all] [FILE]" << std::endl;
+			return 2;
+		}
+	}
+
+	std::vector<double> samples;
+	std::ifstream file;
+	if (path != 0) {
+		file.open(path);
+		if (!file) {
+			std::cerr << argv[0] << ": cannot open " << path << std::endl;
+			return 2;
+		}
+	}
+	std::istream& in = path != 0 ? file : std::cin;
+	double sample;
+	while (in >> sample) {
+		samples.push_back(sample);
+	}
+	if (!in.eof() || arity == 0 || samples.empty() || samples.size() % arity != 0) {
+		std::cerr << argv[0] << ": expected a multiple of " << arity << " numeric samples" << std::endl;
+		return 2;
+	}
+
+	const std::vector<autotune_result> results =
+		autotune(kernel, samples.data(), samples.size() / arity, arity, budget, formats);
+	std::cout << "format    max_error         throughput (eval/s)" << std::endl;
+	for (std::size_t i = 0; i < results.size() && (all || i == 0); ++i) {
+		const autotune_result& res = results[i];
+		std::cout << std::left << std::setw(10)
+			<< (std::to_string(res.integer_bits) + "." + std::to_string(res.fractional_bits))
+			<< std::setw(18) << res.max_error << res.throughput
+			<< (res.feasible ? "" : "  (over budget)") << std::endl;
+	}
+	return results[0].feasible ? 0 : 1;
+}
+
+} // namespace fxp
+
+#endif /* end of include guard: FIXED_POINT_AUTOTUNE_HPP */
@@ -0,0 +1,221 @@
+/** Copyright 2026 Politecnico di Milano
+ * Developed by: Stefano Cherubin
+ * PhD student, Politecnico di Milano
+ * <first_name>.<family_name>@polimi.it
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIXED_POINT_BATCH_HPP
+#define FIXED_POINT_BATCH_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+#include "fixed_point_traits.hpp"
+
+namespace fxp {
+
+//-----------------------------------------------------------------------------
+// BATCH ROUNDING
+//-----------------------------------------------------------------------------
+
+// The kernels below work on the raw value only with masks, adds and selects,
+// no branch and no float conversion, so that the compiler vectorises the
+// loops for every raw_t up to 64 bits at -O3, or at -O2 with
+// -fvect-cost-model=dynamic (check with -fopt-info-vec).
+// in and out may be the same array, otherwise they must not overlap.
+
+/// out[i] = floor(in[i])
+template <typename T>
+void floor(const T* in, T* out, std::size_t n)
+{
+	typedef typename fixed_point_traits<T>::raw_t raw_t;
+	typedef round_fixed_point<raw_t, fixed_point_traits<T>::fractional_length> rounding;
+	_FIXED_POINT_IVDEP_
+	for (std::size_t i = 0; i < n; ++i) {
+		out[i] = T::createRaw(rounding::floor(in[i].getRaw()));
+	}
+}
+
+/// out[i] = ceil(in[i])
+template <typename T>
+void ceil(const T* in, T* out, std::size_t n)
+{
+	typedef typename fixed_point_traits<T>::raw_t raw_t;
+	typedef round_fixed_point<raw_t, fixed_point_traits<T>::fractional_length> rounding;
+	_FIXED_POINT_IVDEP_
+	for (std::size_t i = 0; i < n; ++i) {
+		out[i] = T::createRaw(rounding::ceil(in[i].getRaw()));
+	}
+}
+
+/// out[i] = trunc(in[i])
+template <typename T>
+void trunc(const T* in, T* out, std::size_t n)
+{
+	typedef typename fixed_point_traits<T>::raw_t raw_t;
+	typedef round_fixed_point<raw_t, fixed_point_traits<T>::fractional_length> rounding;
+	_FIXED_POINT_IVDEP_
+	for (std::size_t i = 0; i < n; ++i) {
+		out[i] = T::createRaw(rounding::trunc(in[i].getRaw()));
+	}
+}
+
+/// out[i] = round(in[i]), half away from zero
+template <typename T>
+void round(const T* in, T* out, std::size_t n)
+{
+	typedef typename fixed_point_traits<T>::raw_t raw_t;
+	typedef round_fixed_point<raw_t, fixed_point_traits<T>::fractional_length> rounding;
+	_FIXED_POINT_IVDEP_
+	for (std::size_t i = 0; i < n; ++i) {
+		out[i] = T::createRaw(rounding::round(in[i].getRaw()));
+	}
+}
+
+/// out[i] = frac(in[i]) = in[i] - floor(in[i])
+template <typename T>
+void frac(const T* in, T* out, std::size_t n)
+{
+	typedef typename fixed_point_traits<T>::raw_t raw_t;
+	typedef round_fixed_point<raw_t, fixed_point_traits<T>::fractional_length> rounding;
+	_FIXED_POINT_IVDEP_
+	for (std::size_t i = 0; i < n; ++i) {
+		out[i] = T::createRaw(static_cast<raw_t>(in[i].getRaw() & rounding::frac_mask()));
+	}
+}
+
+/// out[i] = in[i].round(), the closest integer as a plain integer
+/** Meant to turn samples into bin indices, e.g. after scaling by the inverse
+ *  of the bin width. */
+template <typename T>
+void round_to_int(const T* in, typename fixed_point_traits<T>::raw_t* out, std::size_t n)
+{
+	typedef typename fixed_point_traits<T>::raw_t raw_t;
+	typedef round_fixed_point<raw_t, fixed_point_traits<T>::fractional_length> rounding;
+	_FIXED_POINT_IVDEP_
+	for (std::size_t i = 0; i < n; ++i) {
+		out[i] = static_cast<raw_t>(rounding::round(in[i].getRaw()) >> fixed_point_traits<T>::fractional_length);
+	}
+}
+
+//-----------------------------------------------------------------------------
+// BATCH CONVERSION
+//-----------------------------------------------------------------------------
+
+/// Rounding of the fractional bits a conversion drops
+enum conversion_rounding {
+	/// Towards minus infinity, as convert() and convert_to()
+	convert_down,
+	/// To nearest, ties towards plus infinity
+	convert_nearest,
+	/// To nearest, ties to even, unbiased on average
+	convert_nearest_even
+};
+
+/// Conversion of raw values of From to raw values of To, of either family
+/** Dropped fractional bits are rounded without widening; the value is then
+ *  widened enough to shift in new fractional bits and to compare it with
+ *  the range of To, and either clamped to that range (SATURATE) or wrapped
+ *  on the bits of To, as convert_to() does. Everything is shifts, adds and
+ *  min/max, so loops of exec() vectorise into the pack and unpack
+ *  instructions of the target. */
+template <typename From, typename To, conversion_rounding ROUNDING = convert_nearest, bool SATURATE = true>
+struct format_conversion
+{
+	typedef fixed_point_traits<From> from_traits;
+	typedef fixed_point_traits<To> to_traits;
+	typedef typename from_traits::raw_t from_raw_t;
+	typedef typename to_traits::raw_t to_raw_t;
+
+	/// Fractional bits dropped, or added if negative
+	static const int shift = static_cast<int>(from_traits::fractional_length) - to_traits::fractional_length;
+	static const int left_shift = shift < 0 ? -shift : 0;
+	static const int right_shift = shift > 0 ? shift : 0;
+
+	/// Signed width holding a value of From with the new fractional bits, and the range of To
+	static const uint16_t work_bits = get_max<
+		from_traits::bit_width + (from_traits::is_signed ? 0 : 1) + left_shift,
+		to_traits::bit_width + (to_traits::is_signed ? 0 : 1)>::RESULT;
+	typedef typename get_int_with_length<work_bits>::RESULT work_t;
+	typedef typename get_uint_with_length<work_bits>::RESULT uwork_t;
+
+	static_assert(right_shift < static_cast<int>(8 * sizeof(from_raw_t)), "a conversion keeps at least one bit of the raw value");
+
+	static to_raw_t exec(from_raw_t raw) {
+		work_t w = static_cast<work_t>(rounded(raw, std::integral_constant<bool, (right_shift > 0)>()));
+		w = static_cast<work_t>(static_cast<uwork_t>(w) << left_shift);
+		if (SATURATE) {
+			const work_t lo = static_cast<work_t>(to_traits::min_raw());
+			const work_t hi = static_cast<work_t>(to_traits::max_raw());
+			w = w < lo ? lo : w;
+			w = w > hi ? hi : w;
+		}
+		return static_cast<to_raw_t>(static_cast<uwork_t>(w));
+	}
+
+private:
+	static from_raw_t rounded(from_raw_t raw, std::false_type) {
+		return raw;
+	}
+
+	// (raw >> s) + 1 never overflows for s > 0, so rounding needs no wider type
+	static from_raw_t rounded(from_raw_t raw, std::true_type) {
+		const int s = right_shift > 0 ? right_shift : 1;
+		const from_raw_t q = static_cast<from_raw_t>(raw >> s);
+		const from_raw_t half = static_cast<from_raw_t>((raw >> (s - 1)) & 1);
+		if (ROUNDING == convert_nearest) {
+			return static_cast<from_raw_t>(q + half);
+		}
+		if (ROUNDING == convert_nearest_even) {
+			typedef typename from_traits::uraw_t uraw_t;
+			const uraw_t below = (static_cast<uraw_t>(1) << (s - 1)) - 1;
+			const from_raw_t sticky = static_cast<from_raw_t>((static_cast<uraw_t>(raw) & below) != 0);
+			return static_cast<from_raw_t>(q + (half & (sticky | (q & 1))));
+		}
+		return q;
+	}
+};
+
+/// out[i] = in[i] converted to To, rounded by ROUNDING and saturated if SATURATE
+/** in and out must not overlap, unless From and To have the same size and
+ *  in == out. */
+template <typename From, typename To, conversion_rounding ROUNDING = convert_nearest, bool SATURATE = true>
+void convert_array(const From* in, To* out, std::size_t n)
+{
+	typedef format_conversion<From, To, ROUNDING, SATURATE> conversion;
+	_FIXED_POINT_IVDEP_
+	for (std::size_t i = 0; i < n; ++i) {
+		out[i] = To::createRaw(conversion::exec(in[i].getRaw()));
+	}
+}
+
+#if __cplusplus >= 202002L
+/// Convert every value of in into out, which holds at least as many
+template <typename From, typename To, conversion_rounding ROUNDING = convert_nearest, bool SATURATE = true>
+void convert_array(std::span<const From> in, std::span<To> out)
+{
+	convert_array<From, To, ROUNDING, SATURATE>(in.data(), out.data(), in.size());
+}
+#endif
+
+} // namespace fxp
+
+#endif /* end of include guard: FIXED_POINT_BATCH_HPP */
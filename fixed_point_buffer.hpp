@@ -0,0 +1,625 @@
+/** Copyright 2026 Politecnico di Milano
+ * Developed by: Stefano Cherubin
+ * PhD student, Politecnico di Milano
+ * <first_name>.<family_name>@polimi.it
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIXED_POINT_BUFFER_HPP
+#define FIXED_POINT_BUFFER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+#  include <malloc.h>
+#else
+#  include <sys/mman.h>
+#endif
+
+#include "fixed_point_traits.hpp"
+
+namespace fxp {
+
+// Aligned storage for fixed-point data: buffers aligned to a SIMD width and
+// padded to a whole number of vectors, so kernels may load aligned vectors
+// and run their loops over the padding instead of a remainder; an arena for
+// short-lived scratch; and N-dimensional strided views and tensors.
+//
+// Large buffers may ask for transparent huge pages, which cuts the TLB
+// misses of streaming over hundreds of megabytes.
+
+//-----------------------------------------------------------------------------
+// ALLOCATION
+//-----------------------------------------------------------------------------
+
+/// Default alignment, a 512-bit vector and a cache line
+static const std::size_t simd_alignment = 64;
+
+/// Size of a transparent huge page on the common platforms
+static const std::size_t huge_page_size = std::size_t(2) << 20;
+
+/// bytes of memory aligned to alignment, a power of two, or null
+/** With hugepages the block is aligned to huge pages and the kernel is
+ *  advised to back it with them, where it supports that. Release with
+ *  aligned_free(). */
+inline void* aligned_allocate(std::size_t bytes, std::size_t alignment, bool hugepages = false)
+{
+	if (hugepages && bytes >= huge_page_size) {
+		alignment = alignment > huge_page_size ? alignment : huge_page_size;
+		bytes = (bytes + huge_page_size - 1) / huge_page_size * huge_page_size;
+	}
+	alignment = alignment > sizeof(void*) ? alignment : sizeof(void*);
+	bytes = bytes > 0 ? bytes : alignment;
+#if defined(_WIN32)
+	return _aligned_malloc(bytes, alignment);
+#else
+	void* p = nullptr;
+	if (posix_memalign(&p, alignment, bytes) != 0) {
+		return nullptr;
+	}
+#  ifdef MADV_HUGEPAGE
+	if (hugepages && bytes >= huge_page_size) {
+		::madvise(p, bytes, MADV_HUGEPAGE);
+	}
+#  endif
+	return p;
+#endif
+}
+
+inline void aligned_free(void* p)
+{
+#if defined(_WIN32)
+	_aligned_free(p);
+#else
+	std::free(p);
+#endif
+}
+
+/// n rounded up to a multiple of the elements of size size in alignment bytes
+inline std::size_t padded_count(std::size_t n, std::size_t size, std::size_t alignment)
+{
+	const std::size_t lanes = alignment > size ? alignment / size : 1;
+	return (n + lanes - 1) / lanes * lanes;
+}
+
+//-----------------------------------------------------------------------------
+// BUFFER
+//-----------------------------------------------------------------------------
+
+/// Contiguous values of T aligned to ALIGN bytes and padded to a multiple of ALIGN
+/** The padding past size() is zero and stays allocated, so a loop may run
+ *  over padded_size() elements. Values are zero initialised, as in
+ *  std::vector. */
+template <typename T, std::size_t ALIGN = simd_alignment>
+class buffer
+{
+	static_assert(std::is_trivially_copyable<T>::value, "buffers hold trivially copyable values");
+	static_assert((ALIGN & (ALIGN - 1)) == 0 && ALIGN >= alignof(T), "the alignment is a power of two");
+
+public:
+	typedef T value_type;
+	typedef T* iterator;
+	typedef const T* const_iterator;
+	static const std::size_t alignment = ALIGN;
+
+	buffer() : data_(nullptr), size_(0), capacity_(0), hugepages_(false) {}
+
+	/// n zeros, backed by huge pages if hugepages
+	explicit buffer(std::size_t n, bool hugepages = false)
+		: data_(nullptr), size_(0), capacity_(0), hugepages_(hugepages) {
+		resize(n);
+	}
+
+	buffer(std::size_t n, const T& value, bool hugepages = false)
+		: data_(nullptr), size_(0), capacity_(0), hugepages_(hugepages) {
+		resize(n);
+		fill(value);
+	}
+
+	buffer(const T* first, std::size_t n)
+		: data_(nullptr), size_(0), capacity_(0), hugepages_(false) {
+		resize(n);
+		std::copy(first, first + n, data_);
+	}
+
+	buffer(const buffer& other) : buffer(other.size_, other.hugepages_) {
+		const T* from = other.data_;
+		for (std::size_t i = 0; i < size_; ++i) {
+			data_[i] = from[i];
+		}
+	}
+
+	buffer(buffer&& other)
+		: data_(other.data_), size_(other.size_), capacity_(other.capacity_), hugepages_(other.hugepages_) {
+		other.data_ = nullptr;
+		other.size_ = other.capacity_ = 0;
+	}
+
+	buffer& operator=(buffer other) {
+		swap(other);
+		return *this;
+	}
+
+	~buffer() {
+		aligned_free(data_);
+	}
+
+	void swap(buffer& other) {
+		std::swap(data_, other.data_);
+		std::swap(size_, other.size_);
+		std::swap(capacity_, other.capacity_);
+		std::swap(hugepages_, other.hugepages_);
+	}
+
+	/// Resize to n values, keeping the first ones and zeroing the new ones and the padding
+	void resize(std::size_t n) {
+		const std::size_t padded = padded_count(n, sizeof(T), ALIGN);
+		if (padded > capacity_) {
+			T* data = static_cast<T*>(aligned_allocate(padded * sizeof(T), ALIGN, hugepages_));
+			if (data == nullptr) {
+				throw std::bad_alloc();
+			}
+			std::copy(data_, data_ + size_, data);
+			aligned_free(data_);
+			data_ = data;
+			capacity_ = padded;
+		}
+		const std::size_t keep = n < size_ ? n : size_;
+		if (padded > keep) {
+			std::memset(static_cast<void*>(data_ + keep), 0, (padded - keep) * sizeof(T));
+		}
+		size_ = n;
+	}
+
+	/// Allocate room for n values without changing the size
+	void reserve(std::size_t n) {
+		const std::size_t padded = padded_count(n, sizeof(T), ALIGN);
+		if (padded > capacity_) {
+			const std::size_t size = size_;
+			resize(n);
+			size_ = size;
+		}
+	}
+
+	void clear() { resize(0); }
+
+	void fill(const T& value) {
+		_FIXED_POINT_IVDEP_
+		for (std::size_t i = 0; i < size_; ++i) {
+			data_[i] = value;
+		}
+	}
+
+	std::size_t size() const { return size_; }
+	bool empty() const { return size_ == 0; }
+	/// size() rounded up to whole vectors of ALIGN bytes
+	std::size_t padded_size() const { return padded_count(size_, sizeof(T), ALIGN); }
+	/// Values that fit before the next reallocation
+	std::size_t capacity() const { return capacity_; }
+
+	T* data() { return data_; }
+	const T* data() const { return data_; }
+
+	T* begin() { return data_; }
+	T* end() { return data_ + size_; }
+	const T* begin() const { return data_; }
+	const T* end() const { return data_ + size_; }
+
+	T& operator[](std::size_t i) { return data_[i]; }
+	const T& operator[](std::size_t i) const { return data_[i]; }
+
+private:
+	T* data_;
+	std::size_t size_;
+	/// Elements allocated, padded
+	std::size_t capacity_;
+	bool hugepages_;
+};
+
+//-----------------------------------------------------------------------------
+// SCRATCH ARENA
+//-----------------------------------------------------------------------------
+
+/// Bump allocator for temporary scratch, released in stack order
+/** Memory comes from blocks of at least block_size bytes, kept for reuse
+ *  once released, so a loop taking the same scratch at every iteration
+ *  allocates only at the first one. Not thread safe: use one arena per
+ *  thread. */
+class scratch_arena
+{
+public:
+	/// Position to go back to with release()
+	struct marker
+	{
+		std::size_t block;
+		std::size_t offset;
+	};
+
+	explicit scratch_arena(std::size_t block_size = std::size_t(1) << 20, bool hugepages = false)
+		: block_size_(block_size), hugepages_(hugepages), current_(0), offset_(0) {}
+
+	scratch_arena(const scratch_arena&) = delete;
+	scratch_arena& operator=(const scratch_arena&) = delete;
+
+	~scratch_arena() {
+		for (std::size_t b = 0; b < blocks_.size(); ++b) {
+			aligned_free(blocks_[b].data);
+		}
+	}
+
+	/// Uninitialised space for n values of T, aligned and padded to ALIGN bytes
+	/** Throws std::bad_alloc when a new block cannot be allocated. */
+	template <typename T, std::size_t ALIGN = simd_alignment>
+	T* allocate(std::size_t n) {
+		static_assert((ALIGN & (ALIGN - 1)) == 0, "the alignment is a power of two");
+		const std::size_t bytes = padded_count(n, sizeof(T), ALIGN) * sizeof(T);
+		while (current_ < blocks_.size()) {
+			block& b = blocks_[current_];
+			// align the address, blocks are only aligned to the alignment they were made for
+			const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(b.data) + offset_;
+			const std::size_t begin = offset_ + static_cast<std::size_t>((ALIGN - address % ALIGN) % ALIGN);
+			if (begin <= b.size && bytes <= b.size - begin) {
+				offset_ = begin + bytes;
+				return reinterpret_cast<T*>(b.data + begin);
+			}
+			++current_;
+			offset_ = 0;
+		}
+		const std::size_t size = bytes > block_size_ ? bytes : block_size_;
+		block b = {static_cast<char*>(aligned_allocate(size, ALIGN > simd_alignment ? ALIGN : simd_alignment, hugepages_)), size};
+		if (b.data == nullptr) {
+			throw std::bad_alloc();
+		}
+		blocks_.push_back(b);
+		current_ = blocks_.size() - 1;
+		offset_ = bytes;
+		return reinterpret_cast<T*>(b.data);
+	}
+
+	marker mark() const {
+		marker m = {current_, offset_};
+		return m;
+	}
+
+	/// Release everything allocated after m
+	void release(const marker& m) {
+		current_ = m.block;
+		offset_ = m.offset;
+	}
+
+	/// Release everything
+	void reset() {
+		current_ = 0;
+		offset_ = 0;
+	}
+
+private:
+	struct block
+	{
+		char* data;
+		std::size_t size;
+	};
+
+	std::size_t block_size_;
+	bool hugepages_;
+	std::vector<block> blocks_;
+	std::size_t current_;
+	std::size_t offset_;
+};
+
+/// Releases what was allocated from an arena during its lifetime
+class arena_scope
+{
+public:
+	explicit arena_scope(scratch_arena& arena) : arena_(arena), mark_(arena.mark()) {}
+	~arena_scope() { arena_.release(mark_); }
+
+	arena_scope(const arena_scope&) = delete;
+	arena_scope& operator=(const arena_scope&) = delete;
+
+private:
+	scratch_arena& arena_;
+	scratch_arena::marker mark_;
+};
+
+/// Standard allocator drawing from an arena; deallocation is left to the arena
+template <typename U>
+class arena_allocator
+{
+public:
+	typedef U value_type;
+
+	explicit arena_allocator(scratch_arena& arena) : arena_(&arena) {}
+
+	template <typename V>
+	arena_allocator(const arena_allocator<V>& other) : arena_(other.arena()) {}
+
+	U* allocate(std::size_t n) { return arena_->allocate<U>(n); }
+	void deallocate(U*, std::size_t) {}
+
+	scratch_arena* arena() const { return arena_; }
+
+	template <typename V>
+	bool operator==(const arena_allocator<V>& other) const { return arena_ == other.arena(); }
+	template <typename V>
+	bool operator!=(const arena_allocator<V>& other) const { return arena_ != other.arena(); }
+
+private:
+	scratch_arena* arena_;
+};
+
+//-----------------------------------------------------------------------------
+// STRIDED VIEWS
+//-----------------------------------------------------------------------------
+
+template <typename T, std::size_t N>
+class tensor_view;
+
+/// Element or sub-view selected by one index of a view
+template <typename T, std::size_t N>
+struct view_element
+{
+	typedef tensor_view<T, N - 1> type;
+
+	static type make(T* data, const std::size_t* shape, const std::ptrdiff_t* strides) {
+		return type(data, shape + 1, strides + 1);
+	}
+};
+
+template <typename T>
+struct view_element<T, 1>
+{
+	typedef T& type;
+
+	static type make(T* data, const std::size_t*, const std::ptrdiff_t*) {
+		return *data;
+	}
+};
+
+/// N-dimensional strided view of values of T, not owning them
+/** Strides are in elements and may be negative or zero; slicing and
+ *  transposing only change the shape, the strides and the origin. */
+template <typename T, std::size_t N>
+class tensor_view
+{
+	static_assert(N >= 1, "views have at least one dimension");
+
+public:
+	typedef T value_type;
+	static const std::size_t rank = N;
+
+	tensor_view() : data_(nullptr) {
+		for (std::size_t d = 0; d < N; ++d) {
+			shape_[d] = 0;
+			strides_[d] = 0;
+		}
+	}
+
+	tensor_view(T* data, const std::size_t* shape, const std::ptrdiff_t* strides) : data_(data) {
+		for (std::size_t d = 0; d < N; ++d) {
+			shape_[d] = shape[d];
+			strides_[d] = strides[d];
+		}
+	}
+
+	/// Row-major view of contiguous data of the given shape
+	tensor_view(T* data, const std::size_t* shape) : data_(data) {
+		std::ptrdiff_t stride = 1;
+		for (std::size_t d = N; d-- > 0; ) {
+			shape_[d] = shape[d];
+			strides_[d] = stride;
+			stride *= static_cast<std::ptrdiff_t>(shape[d]);
+		}
+	}
+
+	/// Views of T convert to views of const T
+	template <typename U>
+	tensor_view(const tensor_view<U, N>& other,
+		typename std::enable_if<std::is_convertible<U*, T*>::value>::type* = nullptr) : data_(other.data()) {
+		for (std::size_t d = 0; d < N; ++d) {
+			shape_[d] = other.shape(d);
+			strides_[d] = other.stride(d);
+		}
+	}
+
+	T* data() const { return data_; }
+	std::size_t shape(std::size_t d) const { return shape_[d]; }
+	std::ptrdiff_t stride(std::size_t d) const { return strides_[d]; }
+	const std::size_t* shape() const { return shape_; }
+	const std::ptrdiff_t* strides() const { return strides_; }
+
+	/// Number of elements
+	std::size_t size() const {
+		std::size_t n = 1;
+		for (std::size_t d = 0; d < N; ++d) {
+			n *= shape_[d];
+		}
+		return n;
+	}
+
+	/// True when the elements are contiguous in row-major order
+	bool contiguous() const {
+		std::ptrdiff_t stride = 1;
+		for (std::size_t d = N; d-- > 0; ) {
+			if (shape_[d] != 1 && strides_[d] != stride) {
+				return false;
+			}
+			stride *= static_cast<std::ptrdiff_t>(shape_[d]);
+		}
+		return true;
+	}
+
+	/// Sub-view of index i of the first dimension, or element for N = 1
+	typename view_element<T, N>::type operator[](std::size_t i) const {
+		return view_element<T, N>::make(data_ + static_cast<std::ptrdiff_t>(i) * strides_[0], shape_, strides_);
+	}
+
+	/// Element at the given N indices
+	template <typename... I>
+	T& operator()(I... indices) const {
+		static_assert(sizeof...(I) == N, "one index per dimension");
+		const std::size_t index[N] = {static_cast<std::size_t>(indices)...};
+		std::ptrdiff_t offset = 0;
+		for (std::size_t d = 0; d < N; ++d) {
+			offset += static_cast<std::ptrdiff_t>(index[d]) * strides_[d];
+		}
+		return data_[offset];
+	}
+
+	/// Elements [begin, end) of dimension d, every step-th one
+	tensor_view slice(std::size_t d, std::size_t begin, std::size_t end, std::size_t step = 1) const {
+		tensor_view v(*this);
+		v.data_ = data_ + static_cast<std::ptrdiff_t>(begin) * strides_[d];
+		v.shape_[d] = end > begin ? (end - begin + step - 1) / step : 0;
+		v.strides_[d] = strides_[d] * static_cast<std::ptrdiff_t>(step);
+		return v;
+	}
+
+	/// Dimensions a and b swapped
+	tensor_view transpose(std::size_t a = 0, std::size_t b = N - 1) const {
+		tensor_view v(*this);
+		std::swap(v.shape_[a], v.shape_[b]);
+		std::swap(v.strides_[a], v.strides_[b]);
+		return v;
+	}
+
+	/// Dimension d walked backwards
+	tensor_view reverse(std::size_t d) const {
+		tensor_view v(*this);
+		if (shape_[d] > 0) {
+			v.data_ = data_ + static_cast<std::ptrdiff_t>(shape_[d] - 1) * strides_[d];
+		}
+		v.strides_[d] = -strides_[d];
+		return v;
+	}
+
+private:
+	T* data_;
+	std::size_t shape_[N];
+	std::ptrdiff_t strides_[N];
+};
+
+//-----------------------------------------------------------------------------
+// TENSOR
+//-----------------------------------------------------------------------------
+
+/// N-dimensional row-major tensor of values of T owning an aligned buffer
+/** Every row of the last dimension starts aligned to ALIGN bytes and is
+ *  padded to whole vectors, so row kernels need neither a peeled head nor a
+ *  remainder; row_stride() is the padded row length. */
+template <typename T, std::size_t N, std::size_t ALIGN = simd_alignment>
+class tensor
+{
+public:
+	typedef T value_type;
+	typedef tensor_view<T, N> view_t;
+	typedef tensor_view<const T, N> const_view_t;
+	static const std::size_t rank = N;
+
+	tensor() {
+		for (std::size_t d = 0; d < N; ++d) {
+			shape_[d] = 0;
+		}
+	}
+
+	/// Zero tensor of the given shape, backed by huge pages if hugepages
+	explicit tensor(const std::size_t (&shape)[N], bool hugepages = false) {
+		std::size_t rows = 1;
+		for (std::size_t d = 0; d < N; ++d) {
+			shape_[d] = shape[d];
+			rows *= d + 1 < N ? shape[d] : 1;
+		}
+		buffer<T, ALIGN>(rows * row_stride(), hugepages).swap(values_);
+	}
+
+	std::size_t shape(std::size_t d) const { return shape_[d]; }
+
+	/// Distance in elements between consecutive rows of the last dimension
+	std::size_t row_stride() const { return padded_count(shape_[N - 1], sizeof(T), ALIGN); }
+
+	/// Number of elements, padding excluded
+	std::size_t size() const {
+		std::size_t n = 1;
+		for (std::size_t d = 0; d < N; ++d) {
+			n *= shape_[d];
+		}
+		return n;
+	}
+
+	T* data() { return values_.data(); }
+	const T* data() const { return values_.data(); }
+
+	view_t view() { return view_t(values_.data(), shape_, strides().data); }
+	const_view_t view() const { return const_view_t(values_.data(), shape_, strides().data); }
+
+	template <typename... I>
+	T& operator()(I... indices) { return view()(indices...); }
+	template <typename... I>
+	const T& operator()(I... indices) const { return view()(indices...); }
+
+	typename view_element<T, N>::type operator[](std::size_t i) { return view()[i]; }
+	typename view_element<const T, N>::type operator[](std::size_t i) const { return view()[i]; }
+
+	/// Set every element, padding excluded
+	void fill(const T& value) {
+		const std::size_t stride = row_stride();
+		const std::size_t width = shape_[N - 1];
+		const std::size_t rows = width > 0 ? size() / width : 0;
+		for (std::size_t r = 0; r < rows; ++r) {
+			T* row = values_.data() + r * stride;
+			_FIXED_POINT_IVDEP_
+			for (std::size_t i = 0; i < width; ++i) {
+				row[i] = value;
+			}
+		}
+	}
+
+private:
+	struct stride_array
+	{
+		std::ptrdiff_t data[N];
+	};
+
+	std::size_t shape_[N];
+	buffer<T, ALIGN> values_;
+
+	stride_array strides() const {
+		stride_array s;
+		std::ptrdiff_t stride = static_cast<std::ptrdiff_t>(row_stride());
+		s.data[N - 1] = 1;
+		for (std::size_t d = N - 1; d-- > 0; ) {
+			s.data[d] = stride;
+			stride *= static_cast<std::ptrdiff_t>(shape_[d]);
+		}
+		return s;
+	}
+};
+
+} // namespace fxp
+
+#endif /* end of include guard: FIXED_POINT_BUFFER_HPP */
@@ -0,0 +1,448 @@
+/** Copyright 2026 Politecnico di Milano
+ * Developed by: Stefano Cherubin
+ * PhD student, Politecnico di Milano
+ * <first_name>.<family_name>@polimi.it
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIXED_POINT_CODEC_HPP
+#define FIXED_POINT_CODEC_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "fixed_point_parallel.hpp"
+#include "fixed_point_traits.hpp"
+
+namespace fxp {
+
+// Lossless compression of streams of fixed-point values, for signals that
+// change slowly. The stream is cut in blocks; each block predicts every
+// value from the previous ones (first or second order differences, the one
+// packing tighter), zigzag maps the residuals to unsigned words, subtracts
+// their minimum (frame of reference) and packs them on the bits the largest
+// one needs.
+//
+// Residuals are packed in lanes, value i of a block in lane i % lanes, so
+// unpacking shifts whole vectors by the same amounts; only the final prefix
+// sums run along the block. Blocks are independent and indexed, so any block
+// is decoded without the ones before it.
+//
+// Layout, every field little-endian:
+//   header  "FXPC", version, signed, integer_length (16 bits),
+//           fractional_length (16 bits), block_size (16 bits)
+//   blocks  predictor, width, two padding bytes, first value and reference
+//           as words, packed words
+//   index   offset of every block from the start of the stream (64 bits)
+//   footer  number of values, number of blocks, offset of the index (64 bits)
+// Words are 32 bits for formats up to 32 bits, 64 bits otherwise.
+
+//-----------------------------------------------------------------------------
+// FORMAT
+//-----------------------------------------------------------------------------
+
+/// Word, lane count and byte helpers of the codec for values of T
+template <typename T>
+struct codec_traits
+{
+	typedef fixed_point_traits<T> traits;
+	static_assert(traits::is_fixed_point && traits::bit_width <= 64, "the codec packs formats up to 64 bits");
+
+	typedef typename std::conditional<traits::bit_width <= 32, uint32_t, uint64_t>::type word_t;
+	typedef typename std::conditional<traits::bit_width <= 32, int32_t, int64_t>::type sword_t;
+	static const int word_bits = sizeof(word_t) * 8;
+	/// Words of a 256-bit vector
+	static const std::size_t lanes = 32 / sizeof(word_t);
+
+	static const std::size_t header_bytes = 12;
+	static const std::size_t block_header_bytes = 4 + 2 * sizeof(word_t);
+	static const std::size_t footer_bytes = 24;
+
+	/// Raw value as a word, modulo 2^word_bits
+	static word_t to_word(const T& value) {
+		return static_cast<word_t>(static_cast<sword_t>(value.getRaw()));
+	}
+
+	static T from_word(word_t word) {
+		return T::createRaw(static_cast<typename traits::raw_t>(static_cast<sword_t>(word)));
+	}
+
+	static word_t zigzag(word_t d) {
+		return static_cast<word_t>(d << 1) ^ static_cast<word_t>(static_cast<sword_t>(d) >> (word_bits - 1));
+	}
+
+	static word_t unzigzag(word_t z) {
+		return static_cast<word_t>(z >> 1) ^ static_cast<word_t>(-static_cast<word_t>(z & 1));
+	}
+
+	/// Packed words of a block of block_size values on width bits
+	static std::size_t packed_words(std::size_t block_size, int width) {
+		const std::size_t per_lane = block_size / lanes;
+		return lanes * ((per_lane * width + word_bits - 1) / word_bits);
+	}
+};
+
+/// Little-endian store and load of the low bytes bytes of v
+inline void store_le(uint8_t* p, uint64_t v, std::size_t bytes)
+{
+	for (std::size_t k = 0; k < bytes; ++k) {
+		p[k] = static_cast<uint8_t>(v >> (8 * k));
+	}
+}
+
+inline uint64_t load_le(const uint8_t* p, std::size_t bytes)
+{
+	uint64_t v = 0;
+	for (std::size_t k = 0; k < bytes; ++k) {
+		v |= static_cast<uint64_t>(p[k]) << (8 * k);
+	}
+	return v;
+}
+
+//-----------------------------------------------------------------------------
+// ENCODER
+//-----------------------------------------------------------------------------
+
+/// Streaming encoder of values of T
+/** Values are pushed in any number of calls and packed block by block into
+ *  bytes(); finish() writes the index and the footer. block_size is a
+ *  multiple of codec_traits<T>::lanes, at most 32768. */
+template <typename T>
+class block_encoder
+{
+public:
+	typedef codec_traits<T> codec;
+	typedef typename codec::word_t word_t;
+
+	explicit block_encoder(std::size_t block_size = 256)
+		: block_size_(block_size), count_(0), finished_(false),
+		  z1_(block_size), z2_(block_size), packed_(block_size) {
+		pending_.reserve(block_size);
+		uint8_t header[codec::header_bytes] = {'F', 'X', 'P', 'C', 1,
+			fixed_point_traits<T>::is_signed ? uint8_t(1) : uint8_t(0)};
+		store_le(header + 6, fixed_point_traits<T>::integer_length, 2);
+		store_le(header + 8, fixed_point_traits<T>::fractional_length, 2);
+		store_le(header + 10, block_size, 2);
+		bytes_.assign(header, header + codec::header_bytes);
+	}
+
+	/// Append values[0, n)
+	void push(const T* values, std::size_t n) {
+		for (std::size_t i = 0; i < n; ++i) {
+			pending_.push_back(codec::to_word(values[i]));
+			if (pending_.size() == block_size_) {
+				flush_block();
+			}
+		}
+		count_ += n;
+	}
+
+	/// Write the last partial block, the index and the footer
+	void finish() {
+		if (finished_) {
+			return;
+		}
+		if (!pending_.empty()) {
+			flush_block();
+		}
+		const uint64_t index = bytes_.size();
+		bytes_.resize(bytes_.size() + 8 * offsets_.size() + codec::footer_bytes);
+		uint8_t* p = bytes_.data() + index;
+		for (std::size_t b = 0; b < offsets_.size(); ++b, p += 8) {
+			store_le(p, offsets_[b], 8);
+		}
+		store_le(p, count_, 8);
+		store_le(p + 8, offsets_.size(), 8);
+		store_le(p + 16, index, 8);
+		finished_ = true;
+	}
+
+	/// Encoded stream, complete after finish()
+	const std::vector<uint8_t>& bytes() const { return bytes_; }
+
+private:
+	std::size_t block_size_;
+	uint64_t count_;
+	bool finished_;
+	std::vector<word_t> pending_;
+	/// Residuals of both predictors and packed words of the block being written
+	std::vector<word_t> z1_, z2_, packed_;
+	std::vector<uint64_t> offsets_;
+	std::vector<uint8_t> bytes_;
+
+	/// Zigzag residuals of order-th differences, the block starting from x[0]
+	static void residuals(const word_t* x, std::size_t n, int order, word_t* z) {
+		word_t p1 = x[0], p2 = x[0];
+		for (std::size_t i = 0; i < n; ++i) {
+			const word_t prediction = order == 1 ? p1 : static_cast<word_t>(2 * p1 - p2);
+			z[i] = codec::zigzag(static_cast<word_t>(x[i] - prediction));
+			p2 = p1;
+			p1 = x[i];
+		}
+	}
+
+	/// Bits of the largest z - ref; ref is the smallest z
+	static int width_of(const word_t* z, std::size_t n, word_t& ref) {
+		word_t lo = z[0];
+		for (std::size_t i = 1; i < n; ++i) {
+			lo = z[i] < lo ? z[i] : lo;
+		}
+		word_t bits = 0;
+		for (std::size_t i = 0; i < n; ++i) {
+			bits |= static_cast<word_t>(z[i] - lo);
+		}
+		int width = 0;
+		for (; bits != 0; bits >>= 1) {
+			++width;
+		}
+		ref = lo;
+		return width;
+	}
+
+	void flush_block() {
+		const std::size_t n = pending_.size();
+		const std::size_t lanes = codec::lanes;
+		residuals(pending_.data(), n, 1, z1_.data());
+		residuals(pending_.data(), n, 2, z2_.data());
+		word_t ref1, ref2;
+		const int width1 = width_of(z1_.data(), n, ref1);
+		const int width2 = width_of(z2_.data(), n, ref2);
+		const int order = width2 < width1 ? 2 : 1;
+		const int width = order == 1 ? width1 : width2;
+		const word_t ref = order == 1 ? ref1 : ref2;
+		word_t* z = order == 1 ? z1_.data() : z2_.data();
+		for (std::size_t i = 0; i < block_size_; ++i) {
+			z[i] = i < n ? static_cast<word_t>(z[i] - ref) : word_t(0);
+		}
+
+		const std::size_t words = codec::packed_words(block_size_, width);
+		word_t* packed = packed_.data();
+		std::fill(packed, packed + words, word_t(0));
+		for (std::size_t j = 0; j < block_size_ / lanes && width > 0; ++j) {
+			const std::size_t bit = j * width;
+			const std::size_t word = bit / codec::word_bits;
+			const int offset = static_cast<int>(bit % codec::word_bits);
+			for (std::size_t l = 0; l < lanes; ++l) {
+				const word_t v = z[j * lanes + l];
+				packed[word * lanes + l] |= static_cast<word_t>(v << offset);
+				if (offset + width > codec::word_bits) {
+					packed[(word + 1) * lanes + l] |= static_cast<word_t>(v >> (codec::word_bits - offset));
+				}
+			}
+		}
+
+		offsets_.push_back(bytes_.size());
+		const std::size_t at = bytes_.size();
+		bytes_.resize(at + codec::block_header_bytes + words * sizeof(word_t));
+		uint8_t* p = bytes_.data() + at;
+		p[0] = static_cast<uint8_t>(order);
+		p[1] = static_cast<uint8_t>(width);
+		p[2] = p[3] = 0;
+		store_le(p + 4, pending_[0], sizeof(word_t));
+		store_le(p + 4 + sizeof(word_t), ref, sizeof(word_t));
+		p += codec::block_header_bytes;
+		for (std::size_t k = 0; k < words; ++k, p += sizeof(word_t)) {
+			store_le(p, packed[k], sizeof(word_t));
+		}
+		pending_.clear();
+	}
+};
+
+/// Encoded stream of values[0, n)
+template <typename T>
+std::vector<uint8_t> compress(const T* values, std::size_t n, std::size_t block_size = 256)
+{
+	block_encoder<T> encoder(block_size);
+	encoder.push(values, n);
+	encoder.finish();
+	return encoder.bytes();
+}
+
+//-----------------------------------------------------------------------------
+// DECODER
+//-----------------------------------------------------------------------------
+
+/// Random access decoder of a stream of values of T
+/** The bytes are not copied and must outlive the decoder. valid() is false
+ *  when the stream is truncated or holds another format than T. */
+template <typename T>
+class block_decoder
+{
+public:
+	typedef codec_traits<T> codec;
+	typedef typename codec::word_t word_t;
+
+	block_decoder(const uint8_t* bytes, std::size_t size)
+		: bytes_(bytes), size_(size), block_size_(0), count_(0), blocks_(0), index_(nullptr), valid_(false) {
+		if (size < codec::header_bytes + codec::footer_bytes || std::memcmp(bytes, "FXPC", 4) != 0 || bytes[4] != 1
+			|| bytes[5] != (fixed_point_traits<T>::is_signed ? 1 : 0)
+			|| load_le(bytes + 6, 2) != fixed_point_traits<T>::integer_length
+			|| load_le(bytes + 8, 2) != fixed_point_traits<T>::fractional_length) {
+			return;
+		}
+		block_size_ = static_cast<std::size_t>(load_le(bytes + 10, 2));
+		const uint8_t* footer = bytes + size - codec::footer_bytes;
+		count_ = load_le(footer, 8);
+		blocks_ = load_le(footer + 8, 8);
+		const uint64_t index = load_le(footer + 16, 8);
+		if (block_size_ == 0 || block_size_ % codec::lanes != 0 || index > size - codec::footer_bytes
+			|| blocks_ != (size - codec::footer_bytes - index) / 8
+			|| blocks_ != (count_ + block_size_ - 1) / block_size_) {
+			return;
+		}
+		index_ = bytes + index;
+		valid_ = true;
+	}
+
+	explicit block_decoder(const std::vector<uint8_t>& bytes) : block_decoder(bytes.data(), bytes.size()) {}
+
+	bool valid() const { return valid_; }
+	std::size_t size() const { return static_cast<std::size_t>(count_); }
+	std::size_t blocks() const { return static_cast<std::size_t>(blocks_); }
+	std::size_t block_size() const { return block_size_; }
+
+	/// Decode block b to out, returning its number of values, 0 if it is corrupt
+	std::size_t decode_block(std::size_t b, T* out) const {
+		std::vector<word_t> z(scratch_words());
+		return decode_block(b, out, z.data());
+	}
+
+	/// Decode values [first, first + n) to out
+	void decode(std::size_t first, std::size_t n, T* out) const {
+		std::vector<word_t> z(scratch_words());
+		std::vector<T> block(block_size_);
+		while (n > 0) {
+			const std::size_t b = first / block_size_;
+			const std::size_t skip = first % block_size_;
+			std::size_t count = decode_block(b, block.data(), z.data());
+			count = count > skip ? count - skip : 0;
+			count = count < n ? count : n;
+			if (count == 0) {
+				return;
+			}
+			std::memcpy(static_cast<void*>(out), block.data() + skip, count * sizeof(T));
+			out += count;
+			first += count;
+			n -= count;
+		}
+	}
+
+	/// Decode the whole stream to out[0, size()), blocks split among the threads
+	void decode(T* out, std::size_t grain = 16) const {
+		parallel_for(blocks(), [&](std::size_t begin, std::size_t end) {
+			std::vector<word_t> z(scratch_words());
+			for (std::size_t b = begin; b < end; ++b) {
+				decode_block(b, out + b * block_size_, z.data());
+			}
+		}, grain);
+	}
+
+private:
+	const uint8_t* bytes_;
+	std::size_t size_;
+	std::size_t block_size_;
+	uint64_t count_;
+	uint64_t blocks_;
+	const uint8_t* index_;
+	bool valid_;
+
+	/// Residuals, then packed words and the next word that unpacking reads
+	std::size_t scratch_words() const { return 2 * block_size_ + codec::lanes; }
+
+	/// z holds scratch_words() words
+	std::size_t decode_block(std::size_t b, T* out, word_t* z) const {
+		if (!valid_ || b >= blocks_) {
+			return 0;
+		}
+		const std::size_t lanes = codec::lanes;
+		const std::size_t n = b + 1 < blocks_ ? block_size_ : static_cast<std::size_t>(count_ - b * block_size_);
+		const uint64_t offset = load_le(index_ + 8 * b, 8);
+		if (offset > size_ - codec::block_header_bytes) {
+			return 0;
+		}
+		const uint8_t* p = bytes_ + offset;
+		const int order = p[0];
+		const int width = p[1];
+		const std::size_t words = codec::packed_words(block_size_, width);
+		if ((order != 1 && order != 2) || width > codec::word_bits
+			|| words * sizeof(word_t) > size_ - offset - codec::block_header_bytes) {
+			return 0;
+		}
+		const word_t first = static_cast<word_t>(load_le(p + 4, sizeof(word_t)));
+		const word_t ref = static_cast<word_t>(load_le(p + 4 + sizeof(word_t), sizeof(word_t)));
+		// words are little-endian, as on every target of the library
+		word_t* packed = z + block_size_;
+		std::memcpy(packed, p + codec::block_header_bytes, words * sizeof(word_t));
+
+		// unpack lane by lane, every lane of a step shifted alike
+		const word_t mask = width == codec::word_bits ? ~word_t(0) : static_cast<word_t>((word_t(1) << width) - 1);
+		const std::size_t per_lane = block_size_ / lanes;
+		for (std::size_t j = 0; j < per_lane; ++j) {
+			const std::size_t bit = j * width;
+			const std::size_t word = bit / codec::word_bits;
+			const int offset_bits = static_cast<int>(bit % codec::word_bits);
+			const word_t* lo = packed + word * lanes;
+			const word_t* hi = lo + lanes;
+			word_t* zj = z + j * lanes;
+			// high bits from the next word when the value straddles two
+			const word_t spill = offset_bits + width > codec::word_bits ? ~word_t(0) : word_t(0);
+			const int back = codec::word_bits - 1 - offset_bits;
+			// local copies tell the compiler that zj does not alias the packed words
+			word_t low_words[codec::lanes], high_words[codec::lanes];
+			for (std::size_t l = 0; l < lanes; ++l) {
+				low_words[l] = lo[l];
+				high_words[l] = hi[l];
+			}
+			for (std::size_t l = 0; l < lanes; ++l) {
+				const word_t high = static_cast<word_t>(static_cast<word_t>(high_words[l] << 1) << back) & spill;
+				zj[l] = static_cast<word_t>((((low_words[l] >> offset_bits) | high) & mask) + ref);
+			}
+		}
+		_FIXED_POINT_IVDEP_
+		for (std::size_t i = 0; i < n; ++i) {
+			z[i] = codec::unzigzag(z[i]);
+		}
+
+		// prefix sums of the residuals
+		word_t p1 = first, p2 = first;
+		if (order == 1) {
+			for (std::size_t i = 0; i < n; ++i) {
+				p1 = static_cast<word_t>(p1 + z[i]);
+				out[i] = codec::from_word(p1);
+			}
+		} else {
+			for (std::size_t i = 0; i < n; ++i) {
+				const word_t x = static_cast<word_t>(2 * p1 - p2 + z[i]);
+				p2 = p1;
+				p1 = x;
+				out[i] = codec::from_word(x);
+			}
+		}
+		return n;
+	}
+};
+
+} // namespace fxp
+
+#endif /* end of include guard: FIXED_POINT_CODEC_HPP */
@@ -0,0 +1,362 @@
+/** Copyright 2026 Politecnico di Milano
+ * Developed by: Stefano Cherubin
+ * PhD student, Politecnico di Milano
+ * <first_name>.<family_name>@polimi.it
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIXED_POINT_COMPLEX_HPP
+#define FIXED_POINT_COMPLEX_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include "fixed_point_traits.hpp"
+
+namespace fxp {
+
+//-----------------------------------------------------------------------------
+// COMPLEX FIXED-POINT
+//-----------------------------------------------------------------------------
+
+/// Complex number with fixed-point real and imaginary parts
+/** \tparam T Either a fixed_point_t or a ufixed_point_t, up to 64 bits
+ *
+ *  std::complex is unspecified for non floating point types, and going
+ *  through the generic operators renormalises each of the four partial
+ *  products. Here products are accumulated in the exact wide format
+ *  fixed_point_t<2I, 2F> and shifted back to T once, truncating like the
+ *  fixed_point_t multiplication does.
+ *
+ *  An array of complex<T> is the interleaved layout {re, im, re, im, ...}.
+ */
+template <typename T>
+struct complex
+{
+	typedef fixed_point_traits<T> traits;
+	typedef typename traits::raw_t raw_t;
+	typedef typename traits::wide_t wide_t;
+	typedef typename traits::uwide_t uwide_t;
+
+	typedef T value_type;
+
+	T re;
+	T im;
+
+	complex() : re(), im() {}
+
+	complex(const T& real) : re(real), im(T::createRaw(0)) {}
+
+	complex(const T& real, const T& imag) : re(real), im(imag) {}
+
+	T real() const { return re; }
+
+	T imag() const { return im; }
+
+	//---------------------------------------------------------------------------
+	// wide arithmetic helpers
+	//---------------------------------------------------------------------------
+
+	/// Exact product of two raw values, 2F fractional bits
+	static uwide_t wide_mul(raw_t a, raw_t b) {
+		return static_cast<uwide_t>(static_cast<wide_t>(a) * static_cast<wide_t>(b));
+	}
+
+	/// Back from 2F to F fractional bits
+	static T narrow(uwide_t value) {
+		return T::createRaw(static_cast<raw_t>(static_cast<wide_t>(value) >> traits::fractional_length));
+	}
+
+	//---------------------------------------------------------------------------
+	// arithmetic operators
+	//---------------------------------------------------------------------------
+
+	complex operator+(const complex& value) const {
+		return complex(re + value.re, im + value.im);
+	}
+
+	complex operator-(const complex& value) const {
+		return complex(re - value.re, im - value.im);
+	}
+
+	complex operator-() const {
+		return complex(-re, -im);
+	}
+
+	/// (a + ib)(c + id) = (ac - bd) + i(ad + bc), one shift per component
+	complex operator*(const complex& value) const {
+		return complex(
+			narrow(wide_mul(re.getRaw(), value.re.getRaw()) - wide_mul(im.getRaw(), value.im.getRaw())),
+			narrow(wide_mul(re.getRaw(), value.im.getRaw()) + wide_mul(im.getRaw(), value.re.getRaw())));
+	}
+
+	/// Product with a real number
+	complex operator*(const T& value) const {
+		return complex(
+			narrow(wide_mul(re.getRaw(), value.getRaw())),
+			narrow(wide_mul(im.getRaw(), value.getRaw())));
+	}
+
+	complex& operator+=(const complex& value) {
+		return *this = *this + value;
+	}
+
+	complex& operator-=(const complex& value) {
+		return *this = *this - value;
+	}
+
+	complex& operator*=(const complex& value) {
+		return *this = *this * value;
+	}
+
+	complex& operator*=(const T& value) {
+		return *this = *this * value;
+	}
+
+	bool operator==(const complex& value) const {
+		return re == value.re && im == value.im;
+	}
+
+	bool operator!=(const complex& value) const {
+		return !(*this == value);
+	}
+};
+
+/// Make the complex fixed-point ostream outputtable as (re,im)
+template <typename T>
+std::ostream& operator<<(std::ostream& stream, const complex<T>& value)
+{
+	return stream << '(' << value.re << ',' << value.im << ')';
+}
+
+/// Complex conjugate
+template <typename T>
+complex<T> conj(const complex<T>& value)
+{
+	return complex<T>(value.re, -value.im);
+}
+
+/// Squared magnitude re^2 + im^2
+template <typename T>
+T norm(const complex<T>& value)
+{
+	typedef complex<T> complex_t;
+	return complex_t::narrow(
+		complex_t::wide_mul(value.re.getRaw(), value.re.getRaw()) +
+		complex_t::wide_mul(value.im.getRaw(), value.im.getRaw()));
+}
+
+/// Magnitude, truncated to the resolution of T
+/** The integer square root of re^2 + im^2, which has 2F fractional bits,
+ *  is the raw value of the magnitude with F fractional bits. */
+template <typename T>
+T abs(const complex<T>& value)
+{
+	typedef complex<T> complex_t;
+	typedef typename complex_t::raw_t raw_t;
+	return T::createRaw(static_cast<raw_t>(isqrt(
+		complex_t::wide_mul(value.re.getRaw(), value.re.getRaw()) +
+		complex_t::wide_mul(value.im.getRaw(), value.im.getRaw()))));
+}
+
+/// Product with three real multiplications (Gauss)
+/** k1 = c(a + b), k2 = a(d - c), k3 = b(c + d); re = k1 - k3, im = k1 + k2.
+ *  Sums are taken in the wide format, hence the operands need one bit of
+ *  headroom: |a + b|, |c + d| and |d - c| must fit in T. */
+template <typename T>
+complex<T> mul_gauss(const complex<T>& x, const complex<T>& y)
+{
+	typedef complex<T> complex_t;
+	typedef typename complex_t::wide_t wide_t;
+	typedef typename complex_t::uwide_t uwide_t;
+	const wide_t a = x.re.getRaw(), b = x.im.getRaw();
+	const wide_t c = y.re.getRaw(), d = y.im.getRaw();
+	const uwide_t k1 = static_cast<uwide_t>(c * (a + b));
+	const uwide_t k2 = static_cast<uwide_t>(a * (d - c));
+	const uwide_t k3 = static_cast<uwide_t>(b * (c + d));
+	return complex_t(complex_t::narrow(k1 - k3), complex_t::narrow(k1 + k2));
+}
+
+//-----------------------------------------------------------------------------
+// BATCH KERNELS, INTERLEAVED LAYOUT
+//-----------------------------------------------------------------------------
+
+/// Accumulator of the complex dot products
+/** At least 16 guard bits over the exact product up to 32 bit formats, 64
+ *  bit formats accumulate in the 128 bit product format with no guard bit. */
+template <typename T>
+struct complex_accumulator
+{
+	static const uint16_t bits = 2 * fixed_point_traits<T>::bit_width + 16 < 128
+		? 2 * fixed_point_traits<T>::bit_width + 16 : 128;
+	typedef typename get_int_with_length<bits>::RESULT acc_t;
+	typedef typename get_uint_with_length<bits>::RESULT uacc_t;
+};
+
+template <typename T>
+void mul_scalar(const complex<T>* a, const complex<T>* b, complex<T>* out,
+	std::size_t begin, std::size_t end)
+{
+	_FIXED_POINT_IVDEP_
+	for (std::size_t i = begin; i < end; ++i) {
+		out[i] = a[i] * b[i];
+	}
+}
+
+#ifdef __AVX2__
+/// out[i] = a[i] * b[i] on 16 bit formats, 8 elements per iteration
+/** Each 32 bit lane holds one complex number: pmaddwd of a with the real or
+ *  the imaginary half of b masked out gives ac and bd, pmaddwd with the halves
+ *  of b swapped gives ad + bc. The shifted real and imaginary parts are packed
+ *  back by truncation, which matches the scalar wrap-around. */
+template <uint16_t FRAC_BITS>
+void mul_avx2_16(const void* a, const void* b, void* out, std::size_t n)
+{
+	const __m256i lo_mask = _mm256_set1_epi32(0x0000FFFF);
+	const __m256i swap = _mm256_setr_epi8(
+		2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+		2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+	const char* pa = static_cast<const char*>(a);
+	const char* pb = static_cast<const char*>(b);
+	char* po = static_cast<char*>(out);
+	for (std::size_t i = 0; i + 8 <= n; i += 8) {
+		const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pa + 4 * i));
+		const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pb + 4 * i));
+		const __m256i ac = _mm256_madd_epi16(va, _mm256_and_si256(vb, lo_mask));
+		const __m256i bd = _mm256_madd_epi16(va, _mm256_andnot_si256(lo_mask, vb));
+		const __m256i im = _mm256_madd_epi16(va, _mm256_shuffle_epi8(vb, swap));
+		const __m256i re = _mm256_sub_epi32(ac, bd);
+		const __m256i res = _mm256_or_si256(
+			_mm256_and_si256(_mm256_srai_epi32(re, FRAC_BITS), lo_mask),
+			_mm256_slli_epi32(_mm256_srai_epi32(im, FRAC_BITS), 16));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(po + 4 * i), res);
+	}
+}
+
+template <uint16_t INT_BITS, uint16_t FRAC_BITS>
+void mul_dispatch(const complex< fixed_point_t<INT_BITS, FRAC_BITS> >* a,
+	const complex< fixed_point_t<INT_BITS, FRAC_BITS> >* b,
+	complex< fixed_point_t<INT_BITS, FRAC_BITS> >* out, std::size_t n)
+{
+	typedef fixed_point_t<INT_BITS, FRAC_BITS> fixed_t;
+	if (sizeof(typename fixed_t::raw_t) == 2 && sizeof(complex<fixed_t>) == 4) {
+		mul_avx2_16<FRAC_BITS>(a, b, out, n);
+		mul_scalar(a, b, out, n - n % 8, n);
+	} else {
+		mul_scalar(a, b, out, 0, n);
+	}
+}
+#endif
+
+template <typename T>
+void mul_dispatch(const complex<T>* a, const complex<T>* b, complex<T>* out, std::size_t n)
+{
+	mul_scalar(a, b, out, 0, n);
+}
+
+/// out[i] = a[i] * b[i]
+/** With AVX2 enabled, signed 16 bit formats use a pmaddwd kernel. out may be
+ *  the same array as a or b, otherwise they must not overlap. */
+template <typename T>
+void mul(const complex<T>* a, const complex<T>* b, complex<T>* out, std::size_t n)
+{
+	mul_dispatch(a, b, out, n);
+}
+
+/// out[i] = a[i] * conj(b[i])
+template <typename T>
+void mul_conj(const complex<T>* a, const complex<T>* b, complex<T>* out, std::size_t n)
+{
+	_FIXED_POINT_IVDEP_
+	for (std::size_t i = 0; i < n; ++i) {
+		out[i] = a[i] * conj(b[i]);
+	}
+}
+
+/// sum of a[i] * b[i], accumulated in wide precision and renormalised once
+template <typename T>
+complex<T> dot(const complex<T>* a, const complex<T>* b, std::size_t n)
+{
+	typedef typename complex_accumulator<T>::acc_t acc_t;
+	typedef typename complex_accumulator<T>::uacc_t uacc_t;
+	typedef typename fixed_point_traits<T>::raw_t raw_t;
+	uacc_t re = 0;
+	uacc_t im = 0;
+	for (std::size_t i = 0; i < n; ++i) {
+		const acc_t ar = a[i].re.getRaw(), ai = a[i].im.getRaw();
+		const acc_t br = b[i].re.getRaw(), bi = b[i].im.getRaw();
+		re += static_cast<uacc_t>(ar * br) - static_cast<uacc_t>(ai * bi);
+		im += static_cast<uacc_t>(ar * bi) + static_cast<uacc_t>(ai * br);
+	}
+	const uint16_t shift = fixed_point_traits<T>::fractional_length;
+	return complex<T>(
+		T::createRaw(static_cast<raw_t>(static_cast<acc_t>(re) >> shift)),
+		T::createRaw(static_cast<raw_t>(static_cast<acc_t>(im) >> shift)));
+}
+
+//-----------------------------------------------------------------------------
+// BATCH KERNELS, SPLIT LAYOUT
+//-----------------------------------------------------------------------------
+
+/// out[i] = a[i] * b[i] with real and imaginary parts in separate arrays
+template <typename T>
+void mul(const T* a_re, const T* a_im, const T* b_re, const T* b_im,
+	T* out_re, T* out_im, std::size_t n)
+{
+	typedef complex<T> complex_t;
+	_FIXED_POINT_IVDEP_
+	for (std::size_t i = 0; i < n; ++i) {
+		const T ar = a_re[i], ai = a_im[i], br = b_re[i], bi = b_im[i];
+		out_re[i] = complex_t::narrow(
+			complex_t::wide_mul(ar.getRaw(), br.getRaw()) - complex_t::wide_mul(ai.getRaw(), bi.getRaw()));
+		out_im[i] = complex_t::narrow(
+			complex_t::wide_mul(ar.getRaw(), bi.getRaw()) + complex_t::wide_mul(ai.getRaw(), br.getRaw()));
+	}
+}
+
+/// sum of a[i] * b[i] with real and imaginary parts in separate arrays
+template <typename T>
+complex<T> dot(const T* a_re, const T* a_im, const T* b_re, const T* b_im, std::size_t n)
+{
+	typedef typename complex_accumulator<T>::acc_t acc_t;
+	typedef typename complex_accumulator<T>::uacc_t uacc_t;
+	typedef typename fixed_point_traits<T>::raw_t raw_t;
+	uacc_t re = 0;
+	uacc_t im = 0;
+	for (std::size_t i = 0; i < n; ++i) {
+		const acc_t ar = a_re[i].getRaw(), ai = a_im[i].getRaw();
+		const acc_t br = b_re[i].getRaw(), bi = b_im[i].getRaw();
+		re += static_cast<uacc_t>(ar * br) - static_cast<uacc_t>(ai * bi);
+		im += static_cast<uacc_t>(ar * bi) + static_cast<uacc_t>(ai * br);
+	}
+	const uint16_t shift = fixed_point_traits<T>::fractional_length;
+	return complex<T>(
+		T::createRaw(static_cast<raw_t>(static_cast<acc_t>(re) >> shift)),
+		T::createRaw(static_cast<raw_t>(static_cast<acc_t>(im) >> shift)));
+}
+
+} // namespace fxp
+
+#endif /* end of include guard: FIXED_POINT_COMPLEX_HPP */
@@ -0,0 +1,169 @@
+/** Copyright 2026 Politecnico di Milano
+ * Developed by: Stefano Cherubin
+ * PhD student, Politecnico di Milano
+ * <first_name>.<family_name>@polimi.it
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIXED_POINT_CONST_HPP
+#define FIXED_POINT_CONST_HPP
+
+#include "fixed_point_traits.hpp"
+
+/// Raw value of the real constant value with frac_bits fractional bits
+/** Truncates towards zero like the floating point constructors, and is a
+ *  constant expression, e.g. mul_const<FIXED_POINT_RAW(0.7071, 15), 15>(x).
+ *  frac_bits must be lower than 64. */
+#define FIXED_POINT_RAW(value, frac_bits) \
+	static_cast<int64_t>((value) * static_cast<double>(static_cast<uint64_t>(1) << (frac_bits)))
+
+namespace fxp {
+
+//-----------------------------------------------------------------------------
+// CANONICAL SIGNED DIGIT RECODING
+//-----------------------------------------------------------------------------
+
+// Canonical signed digit (CSD) form of an integer: a sum of +/- 2^k with no
+// two adjacent non-zero digits, which has the fewest non-zero digits among
+// the signed binary representations. The lowest digit of an odd m is
+// 2 - (m mod 4), i.e. +1 if m = 1 (mod 4) and -1 if m = 3 (mod 4).
+
+/// Lowest CSD digit of an odd number
+constexpr int csd_digit(int64_t m)
+{
+	return (m & 3) == 1 ? 1 : -1;
+}
+
+/// (m - csd_digit(m)) / 2 for an odd m, without overflow
+constexpr int64_t csd_next(int64_t m)
+{
+	return (m >> 1) + (csd_digit(m) < 0 ? 1 : 0);
+}
+
+/// Number of non-zero CSD digits of m
+constexpr int csd_weight(int64_t m)
+{
+	return m == 0 ? 0 : (m & 1) == 0 ? csd_weight(m >> 1) : 1 + csd_weight(csd_next(m));
+}
+
+/// Number of trailing zero bits of m, 0 for m == 0
+constexpr int trailing_zeros(int64_t m)
+{
+	return (m == 0 || (m & 1) != 0) ? 0 : 1 + trailing_zeros(m >> 1);
+}
+
+/// Number of significant bits of |m|
+constexpr int bit_length(int64_t m)
+{
+	return m == 0 ? 0 : m == -1 ? 1 : 1 + bit_length(m >> 1);
+}
+
+/// Sum of the terms +/- (x << k) of the CSD form of M
+template <typename uop_t, int64_t M, int SHIFT, bool DONE = (M == 0), bool ODD = ((M & 1) != 0)>
+struct csd_sum;
+
+template <typename uop_t, int64_t M, int SHIFT, bool ODD>
+struct csd_sum<uop_t, M, SHIFT, true, ODD> {
+	static uop_t exec(uop_t) { return 0; }
+};
+
+template <typename uop_t, int64_t M, int SHIFT>
+struct csd_sum<uop_t, M, SHIFT, false, false> {
+	static uop_t exec(uop_t x) { return csd_sum<uop_t, (M >> 1), SHIFT + 1>::exec(x); }
+};
+
+template <typename uop_t, int64_t M, int SHIFT>
+struct csd_sum<uop_t, M, SHIFT, false, true> {
+	static uop_t exec(uop_t x) {
+		const uop_t term = static_cast<uop_t>(x << SHIFT);
+		const uop_t rest = csd_sum<uop_t, csd_next(M), SHIFT + 1>::exec(x);
+		return csd_digit(M) > 0 ? rest + term : rest - term;
+	}
+};
+
+//-----------------------------------------------------------------------------
+// CONSTANT COEFFICIENT MULTIPLICATION
+//-----------------------------------------------------------------------------
+
+/// Plan of x * RAW / 2^COEFF_FRAC_BITS for x of type T
+/** RAW = M * 2^z with M odd: the product is x * M shifted by
+ *  COEFF_FRAC_BITS - z, computed in the narrowest integer holding x * M. */
+template <typename T, int64_t RAW, uint16_t COEFF_FRAC_BITS>
+struct mul_const_plan
+{
+	typedef typename fixed_point_traits<T>::raw_t raw_t;
+
+	static const int zeros = trailing_zeros(RAW);
+	static const int64_t odd = RAW >> zeros;
+	static const int shift = static_cast<int>(COEFF_FRAC_BITS) - zeros;
+	/// x * M needs sizeof(raw_t) * 8 + bit_length(M) bits
+	static const uint16_t product_bits = sizeof(raw_t) * 8 + bit_length(odd);
+	static_assert(product_bits <= 128, "the product of x and the constant exceeds 128 bits");
+	/// One more bit for the CSD partial sums; without it a 128 bit product takes the multiplication
+	static const bool csd_fits = product_bits < 128;
+	static const uint16_t op_bits = csd_fits ? product_bits + 1 : product_bits;
+	/// Shifts alone, or one add on a native integer, beat a multiplication
+	static const bool use_csd = csd_fits && (csd_weight(odd) <= 1 || (op_bits <= 64 && csd_weight(odd) <= 2));
+
+	typedef typename get_int_with_length<op_bits>::RESULT op_t;
+	typedef typename get_uint_with_length<op_bits>::RESULT uop_t;
+
+	static uop_t product(raw_t x) {
+		const uop_t wide_x = static_cast<uop_t>(static_cast<op_t>(x));
+		return use_csd
+			? csd_sum<uop_t, odd, 0>::exec(wide_x)
+			: static_cast<uop_t>(wide_x * static_cast<uop_t>(static_cast<op_t>(odd)));
+	}
+
+	static raw_t exec(raw_t x) {
+		const op_t prod = static_cast<op_t>(product(x));
+		return shift >= 0
+			? static_cast<raw_t>(prod >> (shift >= 0 ? shift : 0))
+			: static_cast<raw_t>(static_cast<uop_t>(prod) << (shift < 0 ? -shift : 0));
+	}
+};
+
+/// x times the compile-time constant RAW / 2^COEFF_FRAC_BITS
+/** Same result as x * C::createRaw(RAW) for any fixed-point C with
+ *  COEFF_FRAC_BITS fractional bits: the exact product truncated to the format
+ *  of x. The trailing zeros of RAW are folded into the final shift, so powers
+ *  of two reduce to a single shift, and 2^a +/- 2^b to a shift-and-add when
+ *  the product fits a native integer; other coefficients become a
+ *  multiplication by the odd part of RAW. The intermediate integer is the
+ *  narrowest one holding the exact product rather than the sum of both
+ *  formats, so a 64 bit x only needs one 64x64->128 multiplication.
+ *
+ *  Example: fxp::mul_const<FIXED_POINT_RAW(0.75, 15), 15>(x) */
+template <int64_t RAW, uint16_t COEFF_FRAC_BITS, typename T>
+T mul_const(const T& x)
+{
+	return T::createRaw(mul_const_plan<T, RAW, COEFF_FRAC_BITS>::exec(x.getRaw()));
+}
+
+/// x times the compile-time constant C::createRaw(RAW)
+template <typename C, int64_t RAW, typename T>
+T mul_const(const T& x)
+{
+	return mul_const<RAW, fixed_point_traits<C>::fractional_length>(x);
+}
+
+} // namespace fxp
+
+#endif /* end of include guard: FIXED_POINT_CONST_HPP */
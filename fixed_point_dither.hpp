@@ -0,0 +1,228 @@
+/** Copyright 2026 Politecnico di Milano
+ * Developed by: Stefano Cherubin
+ * PhD student, Politecnico di Milano
+ * <first_name>.<family_name>@polimi.it
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIXED_POINT_DITHER_HPP
+#define FIXED_POINT_DITHER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "fixed_point_random.hpp"
+#include "fixed_point_traits.hpp"
+
+namespace fxp {
+
+// Requantisation to a format with fewer fractional bits, with TPDF dither
+// and error feedback noise shaping, so the rounding error becomes noise
+// independent of the signal and can be moved out of the band of interest.
+//
+// A sample x is shaped to u = x - sum_k h[k] e[n - k], dithered, rounded to
+// nearest and saturated to y, and e[n] = y - u is kept: y = x + e[n] -
+// sum_k h[k] e[n - k], so the noise transfer function is
+// 1 - sum_k h[k] z^-(k + 1). Samples are interleaved frames of a fixed
+// number of channels, each channel with its own error history, and the
+// state carries over from one call to the next.
+
+//-----------------------------------------------------------------------------
+// NOISE SHAPING FILTERS
+//-----------------------------------------------------------------------------
+
+/// Coefficients of the noise shaping filters, 16 fractional bits
+static const int shaping_fractional_bits = 16;
+
+/// h of the noise transfer function (1 - z^-1)^ORDER, pushing the noise to high frequencies
+/** The noise power grows with the order, C(2 ORDER, ORDER) times the
+ *  unshaped one, while the low frequency noise falls by 6 dB per octave
+ *  and order. */
+template <std::size_t ORDER>
+std::vector<double> highpass_shaping()
+{
+	std::vector<double> h(ORDER);
+	double binomial = 1.0;
+	for (std::size_t k = 1; k <= ORDER; ++k) {
+		binomial = binomial * static_cast<double>(ORDER - k + 1) / static_cast<double>(k);
+		h[k - 1] = (k % 2 == 1) ? binomial : -binomial;
+	}
+	return h;
+}
+
+//-----------------------------------------------------------------------------
+// REQUANTIZER
+//-----------------------------------------------------------------------------
+
+/// Stateful requantizer from From to To with ORDER taps of noise shaping
+/** To has fewer fractional bits than From, at most 32 fewer; both have at
+ *  most 62 bits. With dither, the sum of two independent uniform values of
+ *  one step of To (triangular PDF, TPDF) is added before rounding, which
+ *  makes the first two moments of the error independent of the signal.
+ *
+ *  Without shaping (ORDER = 0) a call is one vectorised loop over all the
+ *  samples; with shaping the recursion runs along time and the loop over
+ *  the channels of a frame is vectorised instead. */
+template <typename From, typename To, std::size_t ORDER = 0>
+class requantizer
+{
+public:
+	typedef fixed_point_traits<From> from_traits;
+	typedef fixed_point_traits<To> to_traits;
+
+	/// Fractional bits dropped
+	static const int shift = from_traits::fractional_length - to_traits::fractional_length;
+
+	static_assert(shift > 0 && shift <= 32, "To drops between 1 and 32 fractional bits of From");
+	static_assert(from_traits::bit_width <= 62 && to_traits::bit_width <= 62, "requantised formats have at most 62 bits");
+
+	/// Requantizer of channels interleaved channels
+	/** h holds the ORDER filter coefficients, e.g. highpass_shaping<ORDER>(). */
+	explicit requantizer(std::size_t channels = 1, const double* h = nullptr, bool dither = true, uint64_t seed = 0)
+		: channels_(channels), dither_(dither), generator_(seed), coefficients_(ORDER, 0),
+		  history_(ORDER * channels, 0),
+		  words_(random_batch), used_(random_batch),
+		  // whole frames per batch
+		  dither_values_(channels > 0 && random_batch / channels > 0 ? random_batch / channels * channels : channels) {
+		for (std::size_t k = 0; k < ORDER && h != nullptr; ++k) {
+			coefficients_[k] = static_cast<int64_t>(h[k] * (1 << shaping_fractional_bits) + (h[k] < 0 ? -0.5 : 0.5));
+		}
+	}
+
+	requantizer(std::size_t channels, const std::vector<double>& h, bool dither = true, uint64_t seed = 0)
+		: requantizer(channels, h.data(), dither, seed) {}
+
+	std::size_t channels() const { return channels_; }
+
+	/// Forget the error history; the dither keeps its stream
+	void reset() {
+		std::fill(history_.begin(), history_.end(), int64_t(0));
+	}
+
+	/// Requantise frames interleaved frames of in to out
+	void process(const From* in, To* out, std::size_t frames) {
+		const std::size_t n = frames * channels_;
+		const std::size_t batch = dither_values_.size();
+		for (std::size_t i = 0; i < n; i += batch) {
+			const std::size_t count = n - i < batch ? n - i : batch;
+			make_dither(count);
+			if (ORDER == 0) {
+				round_block(in + i, out + i, count);
+			} else {
+				shape_block(in + i, out + i, count);
+			}
+		}
+	}
+
+private:
+	std::size_t channels_;
+	bool dither_;
+	xoshiro256pp<> generator_;
+	/// h[k], shaping_fractional_bits fractional bits
+	std::vector<int64_t> coefficients_;
+	/// e[n - 1 - k] of channel c at [k * channels + c], in units of From
+	std::vector<int64_t> history_;
+	/// Random words, of which the first used_ are consumed, so that the
+	/// dither does not depend on how the samples are split into calls
+	std::vector<uint64_t> words_;
+	std::size_t used_;
+	/// TPDF dither of the current batch, in units of From
+	std::vector<int64_t> dither_values_;
+
+	void make_dither(std::size_t count) {
+		int64_t* d = dither_values_.data();
+		if (!dither_) {
+			for (std::size_t k = 0; k < count; ++k) {
+				d[k] = 0;
+			}
+			return;
+		}
+		for (std::size_t filled = 0; filled < count; ) {
+			if (used_ == words_.size()) {
+				generator_.generate(words_.data(), words_.size());
+				used_ = 0;
+			}
+			const std::size_t take = count - filled < words_.size() - used_ ? count - filled : words_.size() - used_;
+			const uint64_t* words = words_.data() + used_;
+			int64_t* out = d + filled;
+			_FIXED_POINT_IVDEP_
+			for (std::size_t k = 0; k < take; ++k) {
+				// two uniform values in [0, 2^shift) from the two halves of the word
+				const int64_t r0 = static_cast<int64_t>(static_cast<uint32_t>(words[k]) >> (32 - shift));
+				const int64_t r1 = static_cast<int64_t>(static_cast<uint32_t>(words[k] >> 32) >> (32 - shift));
+				out[k] = r0 - r1;
+			}
+			used_ += take;
+			filled += take;
+		}
+	}
+
+	/// round((u + d) / 2^shift) saturated to To, in units of To
+	static int64_t quantize(int64_t u, int64_t d) {
+		static const int64_t half = int64_t(1) << (shift - 1);
+		const int64_t max = static_cast<int64_t>(to_traits::max_raw());
+		const int64_t min = static_cast<int64_t>(to_traits::min_raw());
+		const int64_t y = (u + d + half) >> shift;
+		return y < min ? min : y > max ? max : y;
+	}
+
+	void round_block(const From* in, To* out, std::size_t count) {
+		const int64_t* d = dither_values_.data();
+		_FIXED_POINT_IVDEP_
+		for (std::size_t k = 0; k < count; ++k) {
+			out[k] = To::createRaw(static_cast<typename to_traits::raw_t>(
+				quantize(static_cast<int64_t>(in[k].getRaw()), d[k])));
+		}
+	}
+
+	void shape_block(const From* in, To* out, std::size_t count) {
+		static const int64_t half = int64_t(1) << (shaping_fractional_bits - 1);
+		// an error beyond two steps only comes from saturation, and feeding it back would make the loop unstable
+		static const int64_t error_limit = int64_t(2) << shift;
+		const std::size_t channels = channels_;
+		const int64_t* h = coefficients_.data();
+		int64_t* e = history_.data();
+		const int64_t* d = dither_values_.data();
+		for (std::size_t f = 0; f < count; f += channels) {
+			_FIXED_POINT_IVDEP_
+			for (std::size_t c = 0; c < channels; ++c) {
+				int64_t feedback = half;
+				for (std::size_t k = 0; k < ORDER; ++k) {
+					feedback += h[k] * e[k * channels + c];
+				}
+				const int64_t u = static_cast<int64_t>(in[f + c].getRaw()) - (feedback >> shaping_fractional_bits);
+				const int64_t y = quantize(u, d[f + c]);
+				int64_t error = y * (int64_t(1) << shift) - u;
+				error = error > error_limit ? error_limit : error < -error_limit ? -error_limit : error;
+				for (std::size_t k = ORDER - 1; k > 0; --k) {
+					e[k * channels + c] = e[(k - 1) * channels + c];
+				}
+				e[c] = error;
+				out[f + c] = To::createRaw(static_cast<typename to_traits::raw_t>(y));
+			}
+		}
+	}
+};
+
+} // namespace fxp
+
+#endif /* end of include guard: FIXED_POINT_DITHER_HPP */
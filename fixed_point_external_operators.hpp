@@ -153,4 +153,56 @@ fixed_point_t<INT_BITS, FRAC_BITS> sqrt(const fixed_point_t<INT_BITS, FRAC_BITS>
 	return ret;
 }
 
+// Integer-only rounding
+
+/// Largest integer not greater than val
+template<uint16_t INT_BITS, uint16_t FRAC_BITS>
+fixed_point_t<INT_BITS, FRAC_BITS> floor(const fixed_point_t<INT_BITS, FRAC_BITS> val) {
+	typedef fixed_point_t<INT_BITS, FRAC_BITS> fixed_t;
+	return fixed_t::createRaw(round_fixed_point<typename fixed_t::raw_t, FRAC_BITS>::floor(val.getRaw()));
+}
+
+/// Smallest integer not less than val
+template<uint16_t INT_BITS, uint16_t FRAC_BITS>
+fixed_point_t<INT_BITS, FRAC_BITS> ceil(const fixed_point_t<INT_BITS, FRAC_BITS> val) {
+	typedef fixed_point_t<INT_BITS, FRAC_BITS> fixed_t;
+	return fixed_t::createRaw(round_fixed_point<typename fixed_t::raw_t, FRAC_BITS>::ceil(val.getRaw()));
+}
+
+/// Integer part of val, rounding towards zero
+template<uint16_t INT_BITS, uint16_t FRAC_BITS>
+fixed_point_t<INT_BITS, FRAC_BITS> trunc(const fixed_point_t<INT_BITS, FRAC_BITS> val) {
+	typedef fixed_point_t<INT_BITS, FRAC_BITS> fixed_t;
+	return fixed_t::createRaw(round_fixed_point<typename fixed_t::raw_t, FRAC_BITS>::trunc(val.getRaw()));
+}
+
+/// Closest integer to val, rounding half away from zero
+template<uint16_t INT_BITS, uint16_t FRAC_BITS>
+fixed_point_t<INT_BITS, FRAC_BITS> round(const fixed_point_t<INT_BITS, FRAC_BITS> val) {
+	typedef fixed_point_t<INT_BITS, FRAC_BITS> fixed_t;
+	return fixed_t::createRaw(round_fixed_point<typename fixed_t::raw_t, FRAC_BITS>::round(val.getRaw()));
+}
+
+/// Fractional part of val, val - floor(val), always in [0, 1)
+template<uint16_t INT_BITS, uint16_t FRAC_BITS>
+fixed_point_t<INT_BITS, FRAC_BITS> frac(const fixed_point_t<INT_BITS, FRAC_BITS> val) {
+	typedef fixed_point_t<INT_BITS, FRAC_BITS> fixed_t;
+	return fixed_t::createRaw(val.getRaw() - round_fixed_point<typename fixed_t::raw_t, FRAC_BITS>::floor(val.getRaw()));
+}
+
+/// Split val in integer and fractional part, both with the sign of val
+template<uint16_t INT_BITS, uint16_t FRAC_BITS>
+fixed_point_t<INT_BITS, FRAC_BITS> modf(const fixed_point_t<INT_BITS, FRAC_BITS> val, fixed_point_t<INT_BITS, FRAC_BITS>* iptr) {
+	typedef fixed_point_t<INT_BITS, FRAC_BITS> fixed_t;
+	const typename fixed_t::raw_t ipart = round_fixed_point<typename fixed_t::raw_t, FRAC_BITS>::trunc(val.getRaw());
+	*iptr = fixed_t::createRaw(ipart);
+	return fixed_t::createRaw(val.getRaw() - ipart);
+}
+
+/// val times 2^exp, in the same format
+template<uint16_t INT_BITS, uint16_t FRAC_BITS>
+fixed_point_t<INT_BITS, FRAC_BITS> ldexp(const fixed_point_t<INT_BITS, FRAC_BITS> val, const int exp) {
+	return exp >= 0 ? val << exp : val >> -exp;
+}
+
 #endif /* end of include guard: FIXED_POINT_OPERATORS_HPP */
@@ -0,0 +1,430 @@
+/** Copyright 2026 Politecnico di Milano
+ * Developed by: Stefano Cherubin
+ * PhD student, Politecnico di Milano
+ * <first_name>.<family_name>@polimi.it
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIXED_POINT_IMAGE_HPP
+#define FIXED_POINT_IMAGE_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "fixed_point_parallel.hpp"
+#include "fixed_point_traits.hpp"
+
+namespace fxp {
+
+// Image kernels on planes of ufixed_point_t pixels of at most 16 bits, e.g.
+// ufixed_point_t<8, 8> for 8 bit samples with 8 fractional bits or
+// ufixed_point_t<1, 15> for samples in [0, 1]. Unlike the arithmetic
+// operators, results are rounded to nearest and saturated to the range of
+// the pixel format, as usual for images.
+//
+// Rows are processed in tiles whose intermediate rows stay in cache, the
+// tiles being split among the threads. The inner loops run along a row on
+// 32 and 64 bit lanes so that they vectorise at -O3 (vpmulld and vpmuldq
+// with AVX2): 16 bit pixels times 16 bit coefficients do not fit the 8 bit
+// operands of pmaddubsw, and pmulhuw would drop the low half of the product.
+
+//-----------------------------------------------------------------------------
+// PLANES
+//-----------------------------------------------------------------------------
+
+/// View of a plane of pixels, row y starting at data + y * stride
+template <typename T>
+struct plane
+{
+	T* data;
+	std::size_t width;
+	std::size_t height;
+	std::size_t stride;
+
+	plane(T* data, std::size_t width, std::size_t height)
+		: data(data), width(width), height(height), stride(width) {}
+
+	plane(T* data, std::size_t width, std::size_t height, std::size_t stride)
+		: data(data), width(width), height(height), stride(stride) {}
+
+	/// Read-only view of a writable plane
+	template <typename U>
+	plane(const plane<U>& other)
+		: data(other.data), width(other.width), height(other.height), stride(other.stride) {}
+
+	T* row(std::size_t y) const { return data + y * stride; }
+};
+
+template <typename T>
+struct pixel_traits
+{
+	typedef fixed_point_traits<T> traits;
+
+	static_assert(traits::is_fixed_point && !traits::is_signed, "pixels are ufixed_point_t values");
+	static_assert(traits::bit_width <= 16, "pixels have at most 16 bits");
+
+	typedef typename traits::raw_t raw_t;
+
+	/// Raw value of round(value / 2^shift) saturated to the pixel range
+	template <typename int_t>
+	static T round_saturate(int_t value, int shift) {
+		if (shift > 0) {
+			value = (value + (static_cast<int_t>(1) << (shift - 1))) >> shift;
+		}
+		const int_t max = static_cast<int_t>(traits::max_raw());
+		return T::createRaw(static_cast<raw_t>(value < 0 ? 0 : value > max ? max : value));
+	}
+};
+
+/// Rows per thread so that each one gets about default_grain pixels
+inline std::size_t image_grain(std::size_t width)
+{
+	return width > 0 && width < default_grain ? default_grain / width : 1;
+}
+
+/// Index clamped to [0, n)
+inline std::size_t clamp_index(std::ptrdiff_t i, std::size_t n)
+{
+	return i < 0 ? 0 : static_cast<std::size_t>(i) >= n ? n - 1 : static_cast<std::size_t>(i);
+}
+
+//-----------------------------------------------------------------------------
+// SEPARABLE CONVOLUTION
+//-----------------------------------------------------------------------------
+
+/// dst = src convolved with kx along the rows and ky along the columns
+/** dst(x) = sum over t of k[t] src(x + nx / 2 - t): the kernels are
+ *  flipped, as in a true convolution, and tap nx / 2 weighs the pixel
+ *  itself. They have a signed fixed-point format K of at most 16 bits;
+ *  borders replicate the edge pixels.
+ *  The horizontal pass keeps 14 more fractional bits and one guard bit on
+ *  32 bit intermediates, so kernels whose absolute values sum up to 2 do
+ *  not overflow; the vertical pass accumulates on 64 bits and rounds once.
+ *  dst has the size of src and must not overlap it.
+ *  \param tile_rows Output rows computed from one tile of intermediate rows */
+template <typename T, typename K>
+void convolve_separable(plane<const T> src, plane<T> dst,
+	const K* kx, std::size_t nx, const K* ky, std::size_t ny, std::size_t tile_rows = 32)
+{
+	typedef pixel_traits<T> pixel;
+	static_assert(fixed_point_traits<K>::is_fixed_point && fixed_point_traits<K>::bit_width <= 16,
+		"kernel coefficients are fixed-point values of at most 16 bits");
+	static const int frac_k = fixed_point_traits<K>::fractional_length;
+	static const int guard = 14;
+	const std::size_t width = src.width;
+	const std::size_t height = src.height;
+	if (width == 0 || height == 0 || nx == 0 || ny == 0) {
+		return;
+	}
+	if (tile_rows == 0) {
+		tile_rows = 1;
+	}
+	// the passes correlate with the reversed kernels, which starts them
+	// nx - 1 - nx / 2 pixels before the output pixel
+	const std::ptrdiff_t ax = static_cast<std::ptrdiff_t>(nx - 1 - nx / 2);
+	const std::ptrdiff_t ay = static_cast<std::ptrdiff_t>(ny - 1 - ny / 2);
+
+	std::vector<int32_t> cx(nx), cy(ny);
+	for (std::size_t t = 0; t < nx; ++t) { cx[t] = kx[nx - 1 - t].getRaw(); }
+	for (std::size_t t = 0; t < ny; ++t) { cy[t] = ky[ny - 1 - t].getRaw(); }
+
+	// width and height copied, so that stores to the rows cannot alias the loop bounds
+	parallel_for(height, [&, width, height](std::size_t begin, std::size_t end) {
+		std::vector<int32_t> padded(width + nx - 1);
+		std::vector<int64_t> acc(width);
+		std::vector<int32_t> mid((tile_rows + ny - 1) * width);
+		for (std::size_t r0 = begin; r0 < end; r0 += tile_rows) {
+			const std::size_t r1 = r0 + tile_rows < end ? r0 + tile_rows : end;
+			const std::size_t rows = r1 - r0 + ny - 1;
+
+			// horizontal pass over the source rows of the tile
+			for (std::size_t m = 0; m < rows; ++m) {
+				const T* in = src.row(clamp_index(static_cast<std::ptrdiff_t>(r0 + m) - ay, height));
+				for (std::size_t x = 0; x < width + nx - 1; ++x) {
+					padded[x] = in[clamp_index(static_cast<std::ptrdiff_t>(x) - ax, width)].getRaw();
+				}
+				int64_t* a = acc.data();
+				const int32_t* p = padded.data();
+				for (std::size_t x = 0; x < width; ++x) {
+					a[x] = 0;
+				}
+				for (std::size_t t = 0; t < nx; ++t) {
+					const int64_t c = cx[t];
+					_FIXED_POINT_IVDEP_
+					for (std::size_t x = 0; x < width; ++x) {
+						a[x] += c * p[x + t];
+					}
+				}
+				int32_t* out = mid.data() + m * width;
+				const int shift = frac_k - guard;
+				_FIXED_POINT_IVDEP_
+				for (std::size_t x = 0; x < width; ++x) {
+					out[x] = static_cast<int32_t>(shift > 0
+						? (a[x] + (int64_t(1) << (shift > 0 ? shift - 1 : 0))) >> (shift > 0 ? shift : 0)
+						: a[x] << (shift > 0 ? 0 : -shift));
+				}
+			}
+
+			// vertical pass
+			for (std::size_t y = r0; y < r1; ++y) {
+				int64_t* a = acc.data();
+				for (std::size_t x = 0; x < width; ++x) {
+					a[x] = 0;
+				}
+				for (std::size_t t = 0; t < ny; ++t) {
+					const int64_t c = cy[t];
+					const int32_t* m = mid.data() + (y - r0 + t) * width;
+					_FIXED_POINT_IVDEP_
+					for (std::size_t x = 0; x < width; ++x) {
+						a[x] += c * m[x];
+					}
+				}
+				T* out = dst.row(y);
+				for (std::size_t x = 0; x < width; ++x) {
+					out[x] = pixel::round_saturate(a[x], frac_k + guard);
+				}
+			}
+		}
+	}, image_grain(width));
+}
+
+//-----------------------------------------------------------------------------
+// RESIZE
+//-----------------------------------------------------------------------------
+
+enum interpolation {
+	bilinear,
+	bicubic
+};
+
+/// Source taps and weights, 14 fractional bits, of each destination coordinate
+/** Pixel centres are aligned, i.e. destination x maps to source
+ *  (x + 0.5) * src / dst - 0.5, and taps are clamped to the source. */
+struct resize_taps
+{
+	static const int weight_bits = 14;
+
+	std::size_t taps;
+	std::vector<std::size_t> index;
+	std::vector<int32_t> weight;
+
+	resize_taps(std::size_t src, std::size_t dst, interpolation method)
+		: taps(method == bicubic ? 4 : 2), index(dst * taps), weight(dst * taps)
+	{
+		const double scale = static_cast<double>(src) / static_cast<double>(dst);
+		for (std::size_t i = 0; i < dst; ++i) {
+			const double pos = (static_cast<double>(i) + 0.5) * scale - 0.5;
+			const double base = std::floor(pos);
+			const double f = pos - base;
+			double w[4];
+			if (method == bicubic) {
+				// Keys cubic convolution, a = -0.5
+				const double a = -0.5;
+				const double d[4] = { 1 + f, f, 1 - f, 2 - f };
+				for (int t = 0; t < 4; ++t) {
+					const double x = d[t];
+					w[t] = x <= 1 ? ((a + 2) * x - (a + 3)) * x * x + 1
+						: ((a * x - 5 * a) * x + 8 * a) * x - 4 * a;
+				}
+			} else {
+				w[0] = 1 - f;
+				w[1] = f;
+			}
+			const std::ptrdiff_t first = static_cast<std::ptrdiff_t>(base) - (method == bicubic ? 1 : 0);
+			int32_t total = 0;
+			for (std::size_t t = 0; t < taps; ++t) {
+				index[i * taps + t] = clamp_index(first + static_cast<std::ptrdiff_t>(t), src);
+				weight[i * taps + t] = static_cast<int32_t>(std::floor(w[t] * (1 << weight_bits) + 0.5));
+				total += weight[i * taps + t];
+			}
+			// weights sum up to exactly one, so flat areas stay flat
+			weight[i * taps + (taps - 1) / 2] += (1 << weight_bits) - total;
+		}
+	}
+};
+
+/// dst = src resampled to the size of dst
+/** Rows are interpolated horizontally on 32 bit intermediates with 14 more
+ *  fractional bits, then blended vertically on 64 bits and rounded once.
+ *  dst must not overlap src. */
+template <typename T>
+void resize(plane<const T> src, plane<T> dst, interpolation method = bilinear, std::size_t tile_rows = 32)
+{
+	typedef pixel_traits<T> pixel;
+	if (src.width == 0 || src.height == 0 || dst.width == 0 || dst.height == 0) {
+		return;
+	}
+	if (tile_rows == 0) {
+		tile_rows = 1;
+	}
+	const resize_taps tx(src.width, dst.width, method);
+	const resize_taps ty(src.height, dst.height, method);
+	const std::size_t taps = tx.taps;
+	const std::size_t width = dst.width;
+
+	parallel_for(dst.height, [&, width](std::size_t begin, std::size_t end) {
+		// horizontally resized source rows of the tile, first_row being the top one
+		std::vector<int32_t> rows;
+		std::vector<int64_t> acc(width);
+		for (std::size_t r0 = begin; r0 < end; r0 += tile_rows) {
+			const std::size_t r1 = r0 + tile_rows < end ? r0 + tile_rows : end;
+			std::size_t first_row = ty.index[r0 * taps];
+			std::size_t last_row = first_row;
+			for (std::size_t k = r0 * taps; k < r1 * taps; ++k) {
+				first_row = ty.index[k] < first_row ? ty.index[k] : first_row;
+				last_row = ty.index[k] > last_row ? ty.index[k] : last_row;
+			}
+			rows.resize((last_row - first_row + 1) * width);
+			for (std::size_t sy = first_row; sy <= last_row; ++sy) {
+				const T* in = src.row(sy);
+				int32_t* out = rows.data() + (sy - first_row) * width;
+				for (std::size_t x = 0; x < width; ++x) {
+					int32_t sum = 0;
+					for (std::size_t t = 0; t < taps; ++t) {
+						sum += tx.weight[x * taps + t] * static_cast<int32_t>(in[tx.index[x * taps + t]].getRaw());
+					}
+					out[x] = sum;
+				}
+			}
+			for (std::size_t y = r0; y < r1; ++y) {
+				int64_t* a = acc.data();
+				for (std::size_t x = 0; x < width; ++x) {
+					a[x] = 0;
+				}
+				for (std::size_t t = 0; t < taps; ++t) {
+					const int64_t w = ty.weight[y * taps + t];
+					const int32_t* m = rows.data() + (ty.index[y * taps + t] - first_row) * width;
+					_FIXED_POINT_IVDEP_
+					for (std::size_t x = 0; x < width; ++x) {
+						a[x] += w * m[x];
+					}
+				}
+				T* out = dst.row(y);
+				for (std::size_t x = 0; x < width; ++x) {
+					out[x] = pixel::round_saturate(a[x], 2 * resize_taps::weight_bits);
+				}
+			}
+		}
+	}, image_grain(width));
+}
+
+//-----------------------------------------------------------------------------
+// COLOUR CONVERSION
+//-----------------------------------------------------------------------------
+
+/// RGB to YCbCr conversion matrix of luma weights kr and kb, full range
+/** Coefficients have 14 fractional bits. Chroma is offset by half the range
+ *  of the pixel format, e.g. 128 for ufixed_point_t<8, 8>. */
+struct yuv_matrix
+{
+	static const int bits = 14;
+
+	int32_t to_yuv[3][3];
+	int32_t to_rgb[4];
+
+	yuv_matrix(double kr, double kb) {
+		const double kg = 1 - kr - kb;
+		const double forward[3][3] = {
+			{ kr, kg, kb },
+			{ -kr / (2 * (1 - kb)), -kg / (2 * (1 - kb)), 0.5 },
+			{ 0.5, -kg / (2 * (1 - kr)), -kb / (2 * (1 - kr)) }
+		};
+		for (int i = 0; i < 3; ++i) {
+			for (int j = 0; j < 3; ++j) {
+				to_yuv[i][j] = quantize(forward[i][j]);
+			}
+		}
+		// R = Y + cr_r V, G = Y + cb_g U + cr_g V, B = Y + cb_b U
+		to_rgb[0] = quantize(2 * (1 - kr));
+		to_rgb[1] = quantize(-2 * (1 - kb) * kb / kg);
+		to_rgb[2] = quantize(-2 * (1 - kr) * kr / kg);
+		to_rgb[3] = quantize(2 * (1 - kb));
+	}
+
+	static yuv_matrix bt601() { return yuv_matrix(0.299, 0.114); }
+	static yuv_matrix bt709() { return yuv_matrix(0.2126, 0.0722); }
+
+private:
+	static int32_t quantize(double value) {
+		return static_cast<int32_t>(std::floor(value * (1 << bits) + 0.5));
+	}
+};
+
+/// Y, U and V planes of the R, G and B planes
+/** All planes have the size of r. */
+template <typename T>
+void rgb_to_yuv(plane<const T> r, plane<const T> g, plane<const T> b,
+	plane<T> y, plane<T> u, plane<T> v, const yuv_matrix& m = yuv_matrix::bt601())
+{
+	typedef pixel_traits<T> pixel;
+	const int32_t half = static_cast<int32_t>(fixed_point_traits<T>::max_raw() / 2 + 1) << yuv_matrix::bits;
+	const std::size_t width = r.width;
+	parallel_for(r.height, [&, width](std::size_t begin, std::size_t end) {
+		for (std::size_t row = begin; row < end; ++row) {
+			const T* pr = r.row(row);
+			const T* pg = g.row(row);
+			const T* pb = b.row(row);
+			T* py = y.row(row);
+			T* pu = u.row(row);
+			T* pv = v.row(row);
+			_FIXED_POINT_IVDEP_
+			for (std::size_t x = 0; x < width; ++x) {
+				const int32_t cr = pr[x].getRaw(), cg = pg[x].getRaw(), cb = pb[x].getRaw();
+				py[x] = pixel::round_saturate(m.to_yuv[0][0] * cr + m.to_yuv[0][1] * cg + m.to_yuv[0][2] * cb, yuv_matrix::bits);
+				pu[x] = pixel::round_saturate(m.to_yuv[1][0] * cr + m.to_yuv[1][1] * cg + m.to_yuv[1][2] * cb + half, yuv_matrix::bits);
+				pv[x] = pixel::round_saturate(m.to_yuv[2][0] * cr + m.to_yuv[2][1] * cg + m.to_yuv[2][2] * cb + half, yuv_matrix::bits);
+			}
+		}
+	}, image_grain(width));
+}
+
+/// R, G and B planes of the Y, U and V planes
+template <typename T>
+void yuv_to_rgb(plane<const T> y, plane<const T> u, plane<const T> v,
+	plane<T> r, plane<T> g, plane<T> b, const yuv_matrix& m = yuv_matrix::bt601())
+{
+	typedef pixel_traits<T> pixel;
+	const int32_t half = static_cast<int32_t>(fixed_point_traits<T>::max_raw() / 2 + 1);
+	const std::size_t width = y.width;
+	parallel_for(y.height, [&, width](std::size_t begin, std::size_t end) {
+		for (std::size_t row = begin; row < end; ++row) {
+			const T* py = y.row(row);
+			const T* pu = u.row(row);
+			const T* pv = v.row(row);
+			T* pr = r.row(row);
+			T* pg = g.row(row);
+			T* pb = b.row(row);
+			_FIXED_POINT_IVDEP_
+			for (std::size_t x = 0; x < width; ++x) {
+				const int32_t luma = static_cast<int32_t>(py[x].getRaw()) << yuv_matrix::bits;
+				const int32_t cu = static_cast<int32_t>(pu[x].getRaw()) - half;
+				const int32_t cv = static_cast<int32_t>(pv[x].getRaw()) - half;
+				pr[x] = pixel::round_saturate(luma + m.to_rgb[0] * cv, yuv_matrix::bits);
+				pg[x] = pixel::round_saturate(luma + m.to_rgb[1] * cu + m.to_rgb[2] * cv, yuv_matrix::bits);
+				pb[x] = pixel::round_saturate(luma + m.to_rgb[3] * cu, yuv_matrix::bits);
+			}
+		}
+	}, image_grain(width));
+}
+
+} // namespace fxp
+
+#endif /* end of include guard: FIXED_POINT_IMAGE_HPP */
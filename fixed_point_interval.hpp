@@ -0,0 +1,359 @@
+/** Copyright 2026 Politecnico di Milano
+ * Developed by: Stefano Cherubin
+ * PhD student, Politecnico di Milano
+ * <first_name>.<family_name>@polimi.it
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIXED_POINT_INTERVAL_HPP
+#define FIXED_POINT_INTERVAL_HPP
+
+#include <limits>
+#include <type_traits>
+
+#include "fixed_point_traits.hpp"
+
+namespace fxp {
+
+//-----------------------------------------------------------------------------
+// OUTWARD ROUNDED BOUNDS
+//-----------------------------------------------------------------------------
+
+/// 2 to the power of exp, exactly
+_FIXED_POINT_CONSTEXPR14_ long double exp2i(int exp)
+{
+	long double res = 1.0L;
+	for (; exp > 0; --exp) { res *= 2.0L; }
+	for (; exp < 0; ++exp) { res /= 2.0L; }
+	return res;
+}
+
+_FIXED_POINT_CONSTEXPR14_ long double bound_abs(long double x)
+{
+	return x < 0 ? -x : x;
+}
+
+/// Move a lower bound down by more than the rounding error of long double
+_FIXED_POINT_CONSTEXPR14_ long double round_down(long double x)
+{
+	return x - bound_abs(x) * std::numeric_limits<long double>::epsilon()
+		- std::numeric_limits<long double>::denorm_min();
+}
+
+/// Move an upper bound up by more than the rounding error of long double
+_FIXED_POINT_CONSTEXPR14_ long double round_up(long double x)
+{
+	return x + bound_abs(x) * std::numeric_limits<long double>::epsilon()
+		+ std::numeric_limits<long double>::denorm_min();
+}
+
+_FIXED_POINT_CONSTEXPR14_ long double min4(long double a, long double b, long double c, long double d)
+{
+	long double res = a < b ? a : b;
+	res = res < c ? res : c;
+	return res < d ? res : d;
+}
+
+_FIXED_POINT_CONSTEXPR14_ long double max4(long double a, long double b, long double c, long double d)
+{
+	long double res = a > b ? a : b;
+	res = res > c ? res : c;
+	return res > d ? res : d;
+}
+
+//-----------------------------------------------------------------------------
+// INTERVAL FIXED-POINT
+//-----------------------------------------------------------------------------
+
+/// Static error analysis companion of a fixed-point type
+/** \tparam T Either a fixed_point_t or a ufixed_point_t
+ *
+ *  An interval<T> stands for every value a T variable can take at a given
+ *  point of a kernel. It carries two intervals:
+ *   - [lower(), upper()] encloses the exact, infinite precision, result;
+ *   - [error_lower(), error_upper()] encloses the difference between the
+ *     value computed with the T operators and the exact result.
+ *  Operators mirror the fixed_point_t semantics: mixed-format operands are
+ *  converted to the format of the left operand, products are truncated by an
+ *  arithmetic right shift (towards -inf), quotients by an integer division
+ *  (towards zero), and convert<> truncates like convert_fixed_point.
+ *  Whenever the computed value may leave the range of its format the sticky
+ *  overflow() flag is raised.
+ *
+ *  Instantiating a kernel templated on its number type with interval<T> and
+ *  running it once on the input ranges yields worst-case bounds: integer_bits()
+ *  of the outputs is the narrowest safe integer part, and error_bound() is
+ *  the worst-case error of the candidate fractional part.
+ *
+ *  Bounds are long double, rounded outwards at each step. All the members
+ *  are constexpr when compiling with C++14 or later.
+ */
+template <typename T>
+class interval
+{
+	typedef fixed_point_traits<T> traits;
+
+	template <typename U> friend class interval;
+
+	long double lo;
+	long double hi;
+	long double err_lo;
+	long double err_hi;
+	bool ovf;
+
+public:
+	typedef T value_type;
+
+	static const uint16_t integer_length = traits::integer_length;
+	static const uint16_t fractional_length = traits::fractional_length;
+
+	/// Distance between two consecutive values of T
+	static _FIXED_POINT_CONSTEXPR14_ long double quantum() {
+		return exp2i(-static_cast<int>(fractional_length));
+	}
+
+	/// Smallest value of T
+	static _FIXED_POINT_CONSTEXPR14_ long double range_min() {
+		return traits::is_signed ? -exp2i(integer_length - 1) : 0.0L;
+	}
+
+	/// Largest value of T
+	static _FIXED_POINT_CONSTEXPR14_ long double range_max() {
+		return (traits::is_signed ? exp2i(integer_length - 1) : exp2i(integer_length)) - quantum();
+	}
+
+	//---------------------------------------------------------------------------
+	// constructors
+	//---------------------------------------------------------------------------
+
+	/// Exact zero
+	_FIXED_POINT_CONSTEXPR14_ interval()
+		: lo(0), hi(0), err_lo(0), err_hi(0), ovf(false) {}
+
+	/// Explicit bounds
+	_FIXED_POINT_CONSTEXPR14_ interval(long double low, long double high,
+		long double error_low, long double error_high, bool overflow = false)
+		: lo(low), hi(high), err_lo(error_low), err_hi(error_high), ovf(overflow)
+	{
+		check_range();
+	}
+
+	/// A value of T, known exactly
+	interval(const T& value)
+		: lo(value.getValueFLD()), hi(value.getValueFLD()), err_lo(0), err_hi(0), ovf(false) {}
+
+	/// An integer constant, as converted by the T integer constructors
+	template <typename int_t, typename std::enable_if<std::is_integral<int_t>::value, int>::type = 0>
+	_FIXED_POINT_CONSTEXPR14_ interval(int_t value)
+		: lo(static_cast<long double>(value)), hi(static_cast<long double>(value)),
+		  err_lo(0), err_hi(0), ovf(false)
+	{
+		check_range();
+	}
+
+	/// A real constant, as truncated towards zero by the T float constructors
+	template <typename real_t, typename std::enable_if<std::is_floating_point<real_t>::value, int>::type = 0>
+	_FIXED_POINT_CONSTEXPR14_ interval(real_t value)
+		: lo(static_cast<long double>(value)), hi(static_cast<long double>(value)),
+		  err_lo(value > 0 ? -quantum() : 0), err_hi(value < 0 ? quantum() : 0), ovf(false)
+	{
+		check_range();
+	}
+
+	/// Values exactly representable in T, anywhere in [low, high]
+	static _FIXED_POINT_CONSTEXPR14_ interval exact(long double low, long double high) {
+		return interval(low, high, 0, 0);
+	}
+
+	/// Real values in [low, high] converted to T by the float constructors
+	static _FIXED_POINT_CONSTEXPR14_ interval quantized(long double low, long double high) {
+		return interval(low, high, high > 0 ? -quantum() : 0, low < 0 ? quantum() : 0);
+	}
+
+	//---------------------------------------------------------------------------
+	// accessors
+	//---------------------------------------------------------------------------
+
+	/// Lower bound of the exact result
+	_FIXED_POINT_CONSTEXPR14_ long double lower() const { return lo; }
+
+	/// Upper bound of the exact result
+	_FIXED_POINT_CONSTEXPR14_ long double upper() const { return hi; }
+
+	/// Lower bound of computed - exact
+	_FIXED_POINT_CONSTEXPR14_ long double error_lower() const { return err_lo; }
+
+	/// Upper bound of computed - exact
+	_FIXED_POINT_CONSTEXPR14_ long double error_upper() const { return err_hi; }
+
+	/// Worst-case absolute error of the computed value
+	_FIXED_POINT_CONSTEXPR14_ long double error_bound() const {
+		return bound_abs(err_lo) > bound_abs(err_hi) ? bound_abs(err_lo) : bound_abs(err_hi);
+	}
+
+	/// True if any step leading to this value may have overflowed its format
+	_FIXED_POINT_CONSTEXPR14_ bool overflow() const { return ovf; }
+
+	/// Smallest INT_BITS (sign included for signed types) holding the computed value
+	_FIXED_POINT_CONSTEXPR14_ uint16_t integer_bits() const {
+		const long double low = lo + err_lo;
+		const long double high = hi + err_hi;
+		uint16_t bits = traits::is_signed ? 1 : 0;
+		long double limit = 1.0L;
+		while (bits < 128 && !(
+			(traits::is_signed ? -limit <= low : 0 <= low) &&
+			high <= limit - quantum()))
+		{
+			limit *= 2.0L;
+			++bits;
+		}
+		return bits;
+	}
+
+	//---------------------------------------------------------------------------
+	// conversion
+	//---------------------------------------------------------------------------
+
+	/// Same as T::convert, adding the truncation of the dropped fractional bits
+	template <uint16_t INT_BITS_NEW, uint16_t FRAC_BITS_NEW>
+	_FIXED_POINT_CONSTEXPR14_ interval<typename traits::template rebind<INT_BITS_NEW, FRAC_BITS_NEW>::RESULT>
+	convert() const
+	{
+		typedef interval<typename traits::template rebind<INT_BITS_NEW, FRAC_BITS_NEW>::RESULT> target_t;
+		const long double trunc = FRAC_BITS_NEW < fractional_length
+			? target_t::quantum() - quantum() : 0.0L;
+		return target_t(lo, hi, round_down(err_lo - trunc), err_hi, ovf);
+	}
+
+	//---------------------------------------------------------------------------
+	// arithmetic operators
+	//---------------------------------------------------------------------------
+
+	_FIXED_POINT_CONSTEXPR14_ interval operator-() const {
+		return interval(-hi, -lo, -err_hi, -err_lo, ovf);
+	}
+
+	template <typename U>
+	_FIXED_POINT_CONSTEXPR14_ interval operator+(const interval<U>& value) const {
+		const interval op2 = value.template convert<integer_length, fractional_length>();
+		return interval(round_down(lo + op2.lo), round_up(hi + op2.hi),
+			round_down(err_lo + op2.err_lo), round_up(err_hi + op2.err_hi), ovf || op2.ovf);
+	}
+
+	template <typename U>
+	_FIXED_POINT_CONSTEXPR14_ interval operator-(const interval<U>& value) const {
+		const interval op2 = value.template convert<integer_length, fractional_length>();
+		return interval(round_down(lo - op2.hi), round_up(hi - op2.lo),
+			round_down(err_lo - op2.err_hi), round_up(err_hi - op2.err_lo), ovf || op2.ovf);
+	}
+
+	/// Product truncated to the format of the left operand
+	/** (x + ex)(y + ey) - xy = x ey + y ex + ex ey, plus the truncation of the
+	 *  F2 fractional bits of the right operand dropped by the final shift. */
+	template <typename U>
+	_FIXED_POINT_CONSTEXPR14_ interval operator*(const interval<U>& value) const {
+		static_assert(traits::is_signed == fixed_point_traits<U>::is_signed,
+			"mixed signed and unsigned operands");
+		const interval x_ey = mul(*this, value.err_lo, value.err_hi);
+		const interval y_ex = mul(value, err_lo, err_hi);
+		const interval ex_ey = mul(interval(err_lo, err_hi, 0, 0), value.err_lo, value.err_hi);
+		const long double trunc = quantum() - quantum() * interval<U>::quantum();
+		const interval prod = mul(*this, value.lo, value.hi);
+		return interval(prod.lo, prod.hi,
+			round_down(x_ey.lo + y_ex.lo + ex_ey.lo - trunc),
+			round_up(x_ey.hi + y_ex.hi + ex_ey.hi),
+			ovf || value.ovf);
+	}
+
+	/// Quotient truncated towards zero to the format of the left operand
+	/** (x + ex)/(y + ey) - x/y = (y ex - x ey) / (y (y + ey)) */
+	template <typename U>
+	_FIXED_POINT_CONSTEXPR14_ interval operator/(const interval<U>& value) const {
+		static_assert(traits::is_signed == fixed_point_traits<U>::is_signed,
+			"mixed signed and unsigned operands");
+		const long double inf = std::numeric_limits<long double>::infinity();
+		const long double y_lo = value.lo + (value.err_lo < 0 ? value.err_lo : 0);
+		const long double y_hi = value.hi + (value.err_hi > 0 ? value.err_hi : 0);
+		if (y_lo <= 0 && y_hi >= 0) {
+			return interval(-inf, inf, -inf, inf, true);
+		}
+		const interval quot = mul(*this, 1.0L / value.hi, 1.0L / value.lo);
+		const interval num = mul(value, err_lo, err_hi) - mul(*this, value.err_lo, value.err_hi);
+		const interval den = mul(value, y_lo, y_hi);
+		const interval err = mul(num, 1.0L / den.hi, 1.0L / den.lo);
+		return interval(quot.lo, quot.hi,
+			round_down(err.lo - quantum()), round_up(err.hi + quantum()),
+			ovf || value.ovf);
+	}
+
+	template <typename U>
+	_FIXED_POINT_CONSTEXPR14_ interval& operator+=(const interval<U>& value) {
+		return *this = *this + value;
+	}
+
+	template <typename U>
+	_FIXED_POINT_CONSTEXPR14_ interval& operator-=(const interval<U>& value) {
+		return *this = *this - value;
+	}
+
+	template <typename U>
+	_FIXED_POINT_CONSTEXPR14_ interval& operator*=(const interval<U>& value) {
+		return *this = *this * value;
+	}
+
+	template <typename U>
+	_FIXED_POINT_CONSTEXPR14_ interval& operator/=(const interval<U>& value) {
+		return *this = *this / value;
+	}
+
+	/// Scalars are converted to T first, as the T operators do
+	template <typename other_t, typename std::enable_if<std::is_arithmetic<other_t>::value, int>::type = 0>
+	_FIXED_POINT_CONSTEXPR14_ interval operator+(other_t value) const { return *this + interval(value); }
+
+	template <typename other_t, typename std::enable_if<std::is_arithmetic<other_t>::value, int>::type = 0>
+	_FIXED_POINT_CONSTEXPR14_ interval operator-(other_t value) const { return *this - interval(value); }
+
+	template <typename other_t, typename std::enable_if<std::is_arithmetic<other_t>::value, int>::type = 0>
+	_FIXED_POINT_CONSTEXPR14_ interval operator*(other_t value) const { return *this * interval(value); }
+
+	template <typename other_t, typename std::enable_if<std::is_arithmetic<other_t>::value, int>::type = 0>
+	_FIXED_POINT_CONSTEXPR14_ interval operator/(other_t value) const { return *this / interval(value); }
+
+private:
+	/// Raise the overflow flag if the computed value may not fit in T
+	_FIXED_POINT_CONSTEXPR14_ void check_range() {
+		if (lo + err_lo < range_min() || hi + err_hi > range_max()) {
+			ovf = true;
+		}
+	}
+
+	/// Exact range of x * [low, high], without error
+	template <typename U>
+	static _FIXED_POINT_CONSTEXPR14_ interval mul(const interval<U>& x, long double low, long double high) {
+		return interval(
+			round_down(min4(x.lo * low, x.lo * high, x.hi * low, x.hi * high)),
+			round_up(max4(x.lo * low, x.lo * high, x.hi * low, x.hi * high)),
+			0, 0, x.ovf);
+	}
+};
+
+} // namespace fxp
+
+#endif /* end of include guard: FIXED_POINT_INTERVAL_HPP */
@@ -0,0 +1,544 @@
+/** Copyright 2026 Politecnico di Milano
+ * Developed by: Stefano Cherubin
+ * PhD student, Politecnico di Milano
+ * <first_name>.<family_name>@polimi.it
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIXED_POINT_LINALG_HPP
+#define FIXED_POINT_LINALG_HPP
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "fixed_point_parallel.hpp"
+#include "fixed_point_traits.hpp"
+
+namespace fxp {
+
+// Dense solvers on square or tall matrices stored in row-major order, a(i, j)
+// being a[i * lda + j]. Every entry of a factor is one inner product
+// accumulated on the wide raw type of T, i.e. in the exact product format
+// fixed_point_t<2 * INT_BITS, 2 * FRAC_BITS>, and truncated to T once.
+// Divisions become multiplications by a reciprocal computed once per pivot
+// with integer arithmetic, square roots use the integer isqrt.
+// The wide sums are exact as long as they stay within the range of the wide
+// format, whose integer part is twice as long as the one of T.
+
+//-----------------------------------------------------------------------------
+// WIDE ACCUMULATION
+//-----------------------------------------------------------------------------
+
+template <typename T>
+struct linalg_traits
+{
+	typedef fixed_point_traits<T> traits;
+
+	static_assert(traits::is_fixed_point && traits::is_signed, "the solvers need a signed fixed-point type");
+	static_assert(traits::integer_length >= 1, "the solvers need an integer bit for the sign");
+
+	typedef typename traits::raw_t raw_t;
+	typedef typename traits::wide_t wide_t;
+	typedef typename traits::uwide_t uwide_t;
+
+	static const uint16_t frac_bits = traits::fractional_length;
+	static const uint16_t bit_width = traits::bit_width;
+
+	/// Raw value of a with 2 * FRAC_BITS fractional bits
+	static uwide_t widen(const T& a) {
+		return static_cast<uwide_t>(static_cast<wide_t>(a.getRaw())) << frac_bits;
+	}
+
+	/// Raw product of a and b, with 2 * FRAC_BITS fractional bits
+	static uwide_t product(const T& a, const T& b) {
+		return static_cast<uwide_t>(static_cast<wide_t>(a.getRaw()) * static_cast<wide_t>(b.getRaw()));
+	}
+
+	/// Wide raw value truncated to T
+	static T narrow(uwide_t value) {
+		return T::createRaw(static_cast<raw_t>(static_cast<wide_t>(value) >> frac_bits));
+	}
+
+	/// Sum of x[k * incx] * y[k * incy] for k in [0, n), wide
+	static uwide_t dot(const T* x, std::size_t incx, const T* y, std::size_t incy, std::size_t n) {
+		uwide_t acc = 0;
+		for (std::size_t k = 0; k < n; ++k) {
+			acc += product(x[k * incx], y[k * incy]);
+		}
+		return acc;
+	}
+
+	/// Sum of x[k] * y[k] for k in [0, n), wide
+	static uwide_t dot(const T* x, const T* y, std::size_t n) {
+		uwide_t acc = 0;
+		for (std::size_t k = 0; k < n; ++k) {
+			acc += product(x[k], y[k]);
+		}
+		return acc;
+	}
+
+	/// Square root of a positive wide raw value, in T
+	static T sqrt(uwide_t value) {
+		return T::createRaw(static_cast<raw_t>(isqrt(value)));
+	}
+};
+
+/// Integer reciprocal of a non-zero value of T
+/** 1 / value is kept as a mantissa of bit_width bits and a shift, so that
+ *  its relative precision does not depend on the magnitude of value;
+ *  times(x) then costs one multiplication on the wide raw type instead of a
+ *  division. The result is at most a couple of quanta below x / value. */
+template <typename T>
+class reciprocal
+{
+	typedef linalg_traits<T> lt;
+	typedef typename lt::raw_t raw_t;
+	typedef typename lt::wide_t wide_t;
+	typedef typename lt::uwide_t uwide_t;
+
+public:
+	reciprocal() : mantissa(0), shift(0) {}
+
+	explicit reciprocal(const T& value) {
+		const wide_t raw = value.getRaw();
+		const uwide_t magnitude = static_cast<uwide_t>(raw < 0 ? -raw : raw);
+		int length = 0;
+		while (length < static_cast<int>(sizeof(uwide_t) * 8) && (magnitude >> length) != 0) {
+			++length;
+		}
+		// 2^k / |raw| has at most bit_width - 1 bits, so |x| * mantissa fits wide_t
+		const int k = length + lt::bit_width - 2;
+		const uwide_t quotient = (static_cast<uwide_t>(1) << k) / magnitude;
+		mantissa = raw < 0 ? -static_cast<wide_t>(quotient) : static_cast<wide_t>(quotient);
+		shift = k - lt::frac_bits;
+	}
+
+	/// x / value
+	T times(const T& x) const {
+		return T::createRaw(static_cast<raw_t>((static_cast<wide_t>(x.getRaw()) * mantissa) >> shift));
+	}
+
+	/// x / value, clamped to the range of T before narrowing
+	T saturating_times(const T& x) const {
+		typedef fixed_point_traits<T> traits;
+		const wide_t q = (static_cast<wide_t>(x.getRaw()) * mantissa) >> shift;
+		const wide_t lo = static_cast<wide_t>(traits::min_raw());
+		const wide_t hi = static_cast<wide_t>(traits::max_raw());
+		return T::createRaw(static_cast<raw_t>(q < lo ? lo : (q > hi ? hi : q)));
+	}
+
+private:
+	wide_t mantissa;
+	int shift;
+};
+
+//-----------------------------------------------------------------------------
+// CHOLESKY AND LDL^T
+//-----------------------------------------------------------------------------
+
+/// Row i of the Cholesky factor, columns [begin, end), from rows [0, end)
+template <typename T>
+bool cholesky_row(T* a, std::size_t lda, std::size_t i, std::size_t begin, std::size_t end,
+	reciprocal<T>* inv)
+{
+	typedef linalg_traits<T> lt;
+	T* row = a + i * lda;
+	for (std::size_t j = begin; j < end && j <= i; ++j) {
+		const typename lt::uwide_t s = lt::widen(row[j]) - lt::dot(row, a + j * lda, j);
+		if (j < i) {
+			row[j] = inv[j].times(lt::narrow(s));
+		} else {
+			if (static_cast<typename lt::wide_t>(s) <= 0) {
+				return false;
+			}
+			row[i] = lt::sqrt(s);
+			if (row[i].getRaw() == 0) {
+				return false;
+			}
+			inv[i] = reciprocal<T>(row[i]);
+		}
+	}
+	return true;
+}
+
+/// In-place Cholesky factorisation A = L L^T of a symmetric positive definite matrix
+/** Reads the lower triangle of a and overwrites it with L, row by row; the
+ *  strict upper triangle is left untouched. Returns false if a pivot is not
+ *  positive in the format of T, leaving a partially factored. */
+template <typename T>
+bool cholesky(T* a, std::size_t n, std::size_t lda)
+{
+	std::vector< reciprocal<T> > inv(n);
+	for (std::size_t i = 0; i < n; ++i) {
+		if (!cholesky_row(a, lda, i, 0, i + 1, inv.data())) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/// Blocked Cholesky factorisation, same result as cholesky
+/** Rows are factored block rows at a time: the entries left of the diagonal
+ *  block only read finished rows, so they are computed in tiles of block
+ *  columns, which keep the rows they read in cache, and split among the
+ *  threads; the diagonal block follows on the calling thread. */
+template <typename T>
+bool cholesky_blocked(T* a, std::size_t n, std::size_t lda, std::size_t block = 64)
+{
+	if (block == 0) {
+		block = 1;
+	}
+	std::vector< reciprocal<T> > inv(n);
+	for (std::size_t rb = 0; rb < n; rb += block) {
+		const std::size_t re = rb + block < n ? rb + block : n;
+		reciprocal<T>* inv_data = inv.data();
+		parallel_for(re - rb, [=](std::size_t begin, std::size_t end) {
+			for (std::size_t cb = 0; cb < rb; cb += block) {
+				const std::size_t ce = cb + block < rb ? cb + block : rb;
+				for (std::size_t i = rb + begin; i < rb + end; ++i) {
+					cholesky_row(a, lda, i, cb, ce, inv_data);
+				}
+			}
+		}, 1);
+		for (std::size_t i = rb; i < re; ++i) {
+			if (!cholesky_row(a, lda, i, rb, i + 1, inv_data)) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+/// In-place LDL^T factorisation of a symmetric matrix
+/** Reads the lower triangle of a and overwrites its strict part with the
+ *  unit lower triangular L and the diagonal with D. No square root is
+ *  needed and indefinite matrices are accepted; returns false on a zero
+ *  pivot. */
+template <typename T>
+bool ldlt(T* a, std::size_t n, std::size_t lda)
+{
+	typedef linalg_traits<T> lt;
+	std::vector< reciprocal<T> > inv(n);
+	// w(k) = L(i, k) * D(k) of the current row
+	std::vector<T> w(n);
+	for (std::size_t i = 0; i < n; ++i) {
+		T* row = a + i * lda;
+		for (std::size_t j = 0; j < i; ++j) {
+			w[j] = lt::narrow(lt::widen(row[j]) - lt::dot(w.data(), a + j * lda, j));
+			row[j] = inv[j].times(w[j]);
+		}
+		row[i] = lt::narrow(lt::widen(row[i]) - lt::dot(w.data(), row, i));
+		if (row[i].getRaw() == 0) {
+			return false;
+		}
+		inv[i] = reciprocal<T>(row[i]);
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// LU WITH PARTIAL PIVOTING
+//-----------------------------------------------------------------------------
+
+/// Swap rows r1 and r2 of the n columns of a
+template <typename T>
+void swap_rows(T* a, std::size_t lda, std::size_t n, std::size_t r1, std::size_t r2)
+{
+	if (r1 != r2) {
+		for (std::size_t j = 0; j < n; ++j) {
+			std::swap(a[r1 * lda + j], a[r2 * lda + j]);
+		}
+	}
+}
+
+/// In-place LU factorisation P A = L U with partial pivoting
+/** Left-looking: column k is computed from the finished columns left of it,
+ *  each entry as one wide inner product. a is overwritten with the unit
+ *  lower L below the diagonal and U on and above it; row k was swapped with
+ *  row pivots[k] at step k. Returns false on a zero pivot. */
+template <typename T>
+bool lu(T* a, std::size_t n, std::size_t lda, std::size_t* pivots)
+{
+	typedef linalg_traits<T> lt;
+	std::vector<typename lt::uwide_t> s(n);
+	for (std::size_t k = 0; k < n; ++k) {
+		// U(i, k) for i < k, forward substitution with the unit L
+		for (std::size_t i = 0; i < k; ++i) {
+			a[i * lda + k] = lt::narrow(lt::widen(a[i * lda + k]) - lt::dot(a + i * lda, 1, a + k, lda, i));
+		}
+		std::size_t pivot = k;
+		for (std::size_t i = k; i < n; ++i) {
+			s[i] = lt::widen(a[i * lda + k]) - lt::dot(a + i * lda, 1, a + k, lda, k);
+			const typename lt::wide_t v = static_cast<typename lt::wide_t>(s[i]);
+			const typename lt::wide_t best = static_cast<typename lt::wide_t>(s[pivot]);
+			if ((v < 0 ? -v : v) > (best < 0 ? -best : best)) {
+				pivot = i;
+			}
+		}
+		pivots[k] = pivot;
+		swap_rows(a, lda, n, k, pivot);
+		std::swap(s[k], s[pivot]);
+		a[k * lda + k] = lt::narrow(s[k]);
+		if (a[k * lda + k].getRaw() == 0) {
+			return false;
+		}
+		const reciprocal<T> inv(a[k * lda + k]);
+		for (std::size_t i = k + 1; i < n; ++i) {
+			a[i * lda + k] = inv.times(lt::narrow(s[i]));
+		}
+	}
+	return true;
+}
+
+/// Blocked LU factorisation, same result as lu
+/** Columns are processed in panels of block columns. The contribution of
+ *  the finished columns to a whole panel is accumulated first, in wide
+ *  partial sums split among the threads by rows, and the panel is then
+ *  completed column by column on the calling thread. */
+template <typename T>
+bool lu_blocked(T* a, std::size_t n, std::size_t lda, std::size_t* pivots, std::size_t block = 32)
+{
+	typedef linalg_traits<T> lt;
+	typedef typename lt::uwide_t uwide_t;
+	typedef typename lt::wide_t wide_t;
+	if (block == 0) {
+		block = 1;
+	}
+	// acc(i, c): wide partial sum of a(i, kb + c) for rows i >= kb
+	std::vector<uwide_t> acc(n * block);
+	for (std::size_t kb = 0; kb < n; kb += block) {
+		const std::size_t ke = kb + block < n ? kb + block : n;
+		const std::size_t width = ke - kb;
+		uwide_t* acc_data = acc.data();
+
+		// U above the panel, the columns being independent
+		parallel_for(width, [=](std::size_t begin, std::size_t end) {
+			for (std::size_t k = kb + begin; k < kb + end; ++k) {
+				for (std::size_t i = 0; i < kb; ++i) {
+					a[i * lda + k] = lt::narrow(lt::widen(a[i * lda + k]) - lt::dot(a + i * lda, 1, a + k, lda, i));
+				}
+			}
+		}, 1);
+
+		// contribution of the columns left of the panel
+		parallel_for(n - kb, [=](std::size_t begin, std::size_t end) {
+			for (std::size_t i = kb + begin; i < kb + end; ++i) {
+				for (std::size_t c = 0; c < width; ++c) {
+					acc_data[(i - kb) * block + c] = lt::widen(a[i * lda + kb + c])
+						- lt::dot(a + i * lda, 1, a + kb + c, lda, kb);
+				}
+			}
+		}, block);
+
+		for (std::size_t k = kb; k < ke; ++k) {
+			const std::size_t c = k - kb;
+			for (std::size_t i = kb; i < k; ++i) {
+				a[i * lda + k] = lt::narrow(acc[(i - kb) * block + c]
+					- lt::dot(a + i * lda + kb, 1, a + kb * lda + k, lda, i - kb));
+			}
+			std::size_t pivot = k;
+			wide_t best = 0;
+			for (std::size_t i = k; i < n; ++i) {
+				uwide_t& s = acc[(i - kb) * block + c];
+				s -= lt::dot(a + i * lda + kb, 1, a + kb * lda + k, lda, k - kb);
+				const wide_t v = static_cast<wide_t>(s);
+				if (i == k || (v < 0 ? -v : v) > best) {
+					pivot = i;
+					best = v < 0 ? -v : v;
+				}
+			}
+			pivots[k] = pivot;
+			swap_rows(a, lda, n, k, pivot);
+			if (pivot != k) {
+				for (std::size_t j = 0; j < width; ++j) {
+					std::swap(acc[(k - kb) * block + j], acc[(pivot - kb) * block + j]);
+				}
+			}
+			a[k * lda + k] = lt::narrow(acc[(k - kb) * block + c]);
+			if (a[k * lda + k].getRaw() == 0) {
+				return false;
+			}
+			const reciprocal<T> inv(a[k * lda + k]);
+			for (std::size_t i = k + 1; i < n; ++i) {
+				a[i * lda + k] = inv.times(lt::narrow(acc[(i - kb) * block + c]));
+			}
+		}
+	}
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// GIVENS QR
+//-----------------------------------------------------------------------------
+
+/// Givens rotation zeroing b in (a, b)
+template <typename T>
+struct givens_rotation
+{
+	T c;
+	T s;
+	/// sqrt(a^2 + b^2), the new value of a
+	T r;
+
+	givens_rotation(const T& a, const T& b) {
+		typedef linalg_traits<T> lt;
+		r = lt::sqrt(lt::product(a, a) + lt::product(b, b));
+		const reciprocal<T> inv(r);
+		// |c|, |s| <= 1 may not fit formats with a single integer bit,
+		// where 1 saturates to the largest value below it
+		c = inv.saturating_times(a);
+		s = inv.saturating_times(b);
+	}
+
+	/// (x, y) = (c x + s y, c y - s x), each a wide sum truncated once
+	void apply(T& x, T& y) const {
+		typedef linalg_traits<T> lt;
+		const T new_x = lt::narrow(lt::product(c, x) + lt::product(s, y));
+		y = lt::narrow(lt::product(c, y) - lt::product(s, x));
+		x = new_x;
+	}
+};
+
+/// In-place QR factorisation by Givens rotations of an m x n matrix, m >= n
+/** a is overwritten with R in its upper triangle and zeros below; Q is not
+ *  formed, instead the same rotations are applied to the nrhs columns of b
+ *  (m x nrhs, leading dimension ldb), which becomes Q^T b, so that the least
+ *  squares solution follows from solve_upper on its first n rows. The
+ *  rotations of a column are computed first and then applied to the columns
+ *  right of it in blocks of block columns split among the threads. */
+template <typename T>
+void qr_givens(T* a, std::size_t m, std::size_t n, std::size_t lda,
+	T* b = nullptr, std::size_t nrhs = 0, std::size_t ldb = 0, std::size_t block = 64)
+{
+	if (block == 0) {
+		block = 1;
+	}
+	std::vector< givens_rotation<T> > rotations;
+	std::vector<std::size_t> rows;
+	for (std::size_t j = 0; j < n && j < m; ++j) {
+		rotations.clear();
+		rows.clear();
+		for (std::size_t i = j + 1; i < m; ++i) {
+			if (a[i * lda + j].getRaw() != 0) {
+				const givens_rotation<T> g(a[j * lda + j], a[i * lda + j]);
+				a[j * lda + j] = g.r;
+				a[i * lda + j] = T::createRaw(0);
+				rotations.push_back(g);
+				rows.push_back(i);
+			}
+		}
+		if (rotations.empty()) {
+			continue;
+		}
+		// columns j + 1 .. n - 1 of a, then the columns of b
+		const std::size_t columns = (n - j - 1) + nrhs;
+		const givens_rotation<T>* rot = rotations.data();
+		const std::size_t* rot_rows = rows.data();
+		const std::size_t count = rotations.size();
+		parallel_for((columns + block - 1) / block, [=](std::size_t begin, std::size_t end) {
+			for (std::size_t cb = begin * block; cb < end * block && cb < columns; cb += block) {
+				const std::size_t ce = cb + block < columns ? cb + block : columns;
+				for (std::size_t r = 0; r < count; ++r) {
+					for (std::size_t c = cb; c < ce; ++c) {
+						if (c < n - j - 1) {
+							rot[r].apply(a[j * lda + j + 1 + c], a[rot_rows[r] * lda + j + 1 + c]);
+						} else {
+							const std::size_t k = c - (n - j - 1);
+							rot[r].apply(b[j * ldb + k], b[rot_rows[r] * ldb + k]);
+						}
+					}
+				}
+			}
+		}, 1);
+	}
+}
+
+//-----------------------------------------------------------------------------
+// TRIANGULAR SOLVES
+//-----------------------------------------------------------------------------
+
+/// Solve U x = b in place, U upper triangular n x n
+template <typename T>
+void solve_upper(const T* u, std::size_t n, std::size_t lda, T* b)
+{
+	typedef linalg_traits<T> lt;
+	for (std::size_t i = n; i-- > 0; ) {
+		const T* row = u + i * lda;
+		b[i] = reciprocal<T>(row[i]).times(lt::narrow(lt::widen(b[i]) - lt::dot(row + i + 1, b + i + 1, n - i - 1)));
+	}
+}
+
+/// Solve L x = b in place, L lower triangular n x n, with a unit diagonal if unit
+template <typename T>
+void solve_lower(const T* l, std::size_t n, std::size_t lda, T* b, bool unit = false)
+{
+	typedef linalg_traits<T> lt;
+	for (std::size_t i = 0; i < n; ++i) {
+		const T* row = l + i * lda;
+		const T s = lt::narrow(lt::widen(b[i]) - lt::dot(row, b, i));
+		b[i] = unit ? s : reciprocal<T>(row[i]).times(s);
+	}
+}
+
+/// Solve L^T x = b in place, L lower triangular n x n, with a unit diagonal if unit
+template <typename T>
+void solve_lower_transposed(const T* l, std::size_t n, std::size_t lda, T* b, bool unit = false)
+{
+	typedef linalg_traits<T> lt;
+	for (std::size_t i = n; i-- > 0; ) {
+		const T s = lt::narrow(lt::widen(b[i]) - lt::dot(l + (i + 1) * lda + i, lda, b + i + 1, 1, n - i - 1));
+		b[i] = unit ? s : reciprocal<T>(l[i * lda + i]).times(s);
+	}
+}
+
+/// Solve A x = b in place from the factor of cholesky
+template <typename T>
+void cholesky_solve(const T* l, std::size_t n, std::size_t lda, T* b)
+{
+	solve_lower(l, n, lda, b);
+	solve_lower_transposed(l, n, lda, b);
+}
+
+/// Solve A x = b in place from the factors of ldlt
+template <typename T>
+void ldlt_solve(const T* ld, std::size_t n, std::size_t lda, T* b)
+{
+	solve_lower(ld, n, lda, b, true);
+	for (std::size_t i = 0; i < n; ++i) {
+		b[i] = reciprocal<T>(ld[i * lda + i]).times(b[i]);
+	}
+	solve_lower_transposed(ld, n, lda, b, true);
+}
+
+/// Solve A x = b in place from the factors and pivots of lu
+template <typename T>
+void lu_solve(const T* lu, std::size_t n, std::size_t lda, const std::size_t* pivots, T* b)
+{
+	for (std::size_t k = 0; k < n; ++k) {
+		std::swap(b[k], b[pivots[k]]);
+	}
+	solve_lower(lu, n, lda, b, true);
+	solve_upper(lu, n, lda, b);
+}
+
+} // namespace fxp
+
+#endif /* end of include guard: FIXED_POINT_LINALG_HPP */
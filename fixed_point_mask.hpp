@@ -0,0 +1,511 @@
+/** Copyright 2026 Politecnico di Milano
+ * Developed by: Stefano Cherubin
+ * PhD student, Politecnico di Milano
+ * <first_name>.<family_name>@polimi.it
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIXED_POINT_MASK_HPP
+#define FIXED_POINT_MASK_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#include "fixed_point_traits.hpp"
+
+namespace fxp {
+
+// Branch-free comparisons over arrays of fixed-point values. A comparison
+// writes a bitmask, bit i % 64 of word i / 64 for element i, which the
+// other kernels consume: select, count and compact. Comparing with values
+// of another format costs nothing per element: the formats are reconciled
+// at compile time, or once for a scalar threshold, and every element goes
+// through a single raw compare that vectorises into vpcmpgt and friends.
+
+//-----------------------------------------------------------------------------
+// COMPARISONS
+//-----------------------------------------------------------------------------
+
+enum comparison {
+	cmp_less,
+	cmp_less_equal,
+	cmp_greater,
+	cmp_greater_equal,
+	cmp_equal,
+	cmp_not_equal
+};
+
+/// a OP b on raw values
+template <comparison OP, typename X>
+inline bool compare_raw(X a, X b)
+{
+	return OP == cmp_less ? a < b
+		: OP == cmp_less_equal ? a <= b
+		: OP == cmp_greater ? a > b
+		: OP == cmp_greater_equal ? a >= b
+		: OP == cmp_equal ? a == b
+		: a != b;
+}
+
+/// Raw type both A and B convert to exactly, with the larger fractional part
+/** Signed if either is, one more bit for an unsigned operand in that case. */
+template <typename A, typename B>
+struct common_compare_format
+{
+	typedef fixed_point_traits<A> traits_a;
+	typedef fixed_point_traits<B> traits_b;
+
+	static const uint16_t fractional_length = get_max<traits_a::fractional_length, traits_b::fractional_length>::RESULT;
+	static const int shift_a = fractional_length - traits_a::fractional_length;
+	static const int shift_b = fractional_length - traits_b::fractional_length;
+	static const bool is_signed = traits_a::is_signed || traits_b::is_signed;
+	static const uint16_t bits = get_max<
+		traits_a::bit_width + shift_a + ((is_signed && !traits_a::is_signed) ? 1 : 0),
+		traits_b::bit_width + shift_b + ((is_signed && !traits_b::is_signed) ? 1 : 0)>::RESULT;
+
+	typedef typename std::conditional<is_signed,
+		typename get_int_with_length<bits>::RESULT,
+		typename get_uint_with_length<bits>::RESULT>::type raw_t;
+	typedef typename get_uint_with_length<bits>::RESULT uraw_t;
+
+	static raw_t from_a(typename traits_a::raw_t a) {
+		return static_cast<raw_t>(static_cast<uraw_t>(static_cast<raw_t>(a)) << shift_a);
+	}
+
+	static raw_t from_b(typename traits_b::raw_t b) {
+		return static_cast<raw_t>(static_cast<uraw_t>(static_cast<raw_t>(b)) << shift_b);
+	}
+};
+
+/// a OP b for values of two formats, exact, one raw compare
+template <comparison OP, typename A, typename B>
+inline bool compare_values(const A& a, const B& b)
+{
+	typedef common_compare_format<A, B> common;
+	return compare_raw<OP>(common::from_a(a.getRaw()), common::from_b(b.getRaw()));
+}
+
+/// a OP threshold for values a of A, with the threshold moved to the raw values of A
+/** The threshold is rounded the way that keeps the comparison exact, e.g.
+ *  a > 0.3 becomes raw > floor(0.3 * 2^F). A threshold outside the range
+ *  of A, or an equality that no value of A meets, makes the result
+ *  constant. */
+template <comparison OP, typename A>
+class threshold_compare
+{
+public:
+	typedef typename fixed_point_traits<A>::raw_t raw_t;
+
+	template <typename B>
+	explicit threshold_compare(const B& threshold) : constant_(false), value_(false), bound_(0) {
+		typedef common_compare_format<A, B> common;
+		typedef typename common::raw_t wide_t;
+		typedef typename common::uraw_t uwide_t;
+		static const int down = static_cast<int>(fixed_point_traits<B>::fractional_length) - fixed_point_traits<A>::fractional_length;
+		const wide_t lo = static_cast<wide_t>(fixed_point_traits<A>::min_raw());
+		const wide_t hi = static_cast<wide_t>(fixed_point_traits<A>::max_raw());
+
+		// floor and ceil of the threshold in units of A, without overflow
+		// since A has as many integer bits in wide_t as B
+		wide_t below = static_cast<wide_t>(threshold.getRaw());
+		wide_t above = below;
+		if (down > 0) {
+			const int s = down > 0 ? down : 0;
+			below = static_cast<wide_t>(below >> s);
+			above = static_cast<wide_t>(below + ((static_cast<uwide_t>(threshold.getRaw()) & ((uwide_t(1) << s) - 1)) != 0 ? 1 : 0));
+		} else {
+			const int s = down < 0 ? -down : 0;
+			below = above = static_cast<wide_t>(static_cast<uwide_t>(below) << s);
+		}
+
+		switch (OP) {
+		case cmp_greater:
+		case cmp_less_equal:
+			// a > below for every a when below < lo, for none when below >= hi
+			if (below < lo || below >= hi) {
+				set_constant((below < lo) == (OP == cmp_greater));
+			}
+			bound_ = static_cast<raw_t>(below);
+			break;
+		case cmp_greater_equal:
+		case cmp_less:
+			if (above <= lo || above > hi) {
+				set_constant((above <= lo) == (OP == cmp_greater_equal));
+			}
+			bound_ = static_cast<raw_t>(above);
+			break;
+		default:
+			if (below != above || below < lo || below > hi) {
+				set_constant(OP == cmp_not_equal);
+			}
+			bound_ = static_cast<raw_t>(below);
+		}
+	}
+
+	bool operator()(raw_t a) const { return constant_ ? value_ : compare_raw<OP>(a, bound_); }
+
+	/// Whether every value of A gives the same result, value()
+	bool constant() const { return constant_; }
+	bool value() const { return value_; }
+	/// Raw value of A the elements are compared with when not constant
+	raw_t bound() const { return bound_; }
+
+private:
+	void set_constant(bool value) {
+		constant_ = true;
+		value_ = value;
+	}
+
+	bool constant_;
+	bool value_;
+	raw_t bound_;
+};
+
+//-----------------------------------------------------------------------------
+// BITMASKS
+//-----------------------------------------------------------------------------
+
+/// Words of a mask of n elements
+inline std::size_t mask_words(std::size_t n)
+{
+	return (n + 63) / 64;
+}
+
+inline unsigned popcount64(uint64_t x)
+{
+#if defined(__GNUC__)
+	return static_cast<unsigned>(__builtin_popcountll(x));
+#else
+	unsigned count = 0;
+	for (; x != 0; x &= x - 1) {
+		++count;
+	}
+	return count;
+#endif
+}
+
+/// Index of the lowest set bit of a non-zero value
+inline unsigned lowest_bit(uint64_t x)
+{
+#if defined(__GNUC__)
+	return static_cast<unsigned>(__builtin_ctzll(x));
+#else
+	unsigned bit = 0;
+	for (; (x & 1) == 0; x >>= 1) {
+		++bit;
+	}
+	return bit;
+#endif
+}
+
+/// Bit j set for flags[j] != 0, flags 0 or 0xFF
+inline uint64_t pack_flags(const uint8_t* flags)
+{
+#if defined(__AVX2__)
+	const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(flags));
+	const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(flags + 32));
+	return static_cast<uint32_t>(_mm256_movemask_epi8(lo))
+		| (static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(hi))) << 32);
+#else
+	uint64_t word = 0;
+	for (unsigned j = 0; j < 64; ++j) {
+		word |= static_cast<uint64_t>(flags[j] & 1) << j;
+	}
+	return word;
+#endif
+}
+
+/// flags[j] = 0xFF if bit j of word is set, 0 otherwise, the inverse of pack_flags
+inline void unpack_flags(uint64_t word, uint8_t* flags)
+{
+#if defined(__AVX2__)
+	// byte k of each half takes the byte of word holding bit k, then tests it
+	const __m256i spread = _mm256_setr_epi8(
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+		2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3);
+	const __m256i bits = _mm256_set1_epi64x(static_cast<long long>(0x8040201008040201ULL));
+	for (unsigned half = 0; half < 2; ++half) {
+		const uint32_t part = static_cast<uint32_t>(word >> (32 * half));
+		// shuffle_epi8 works within 128-bit lanes, the high lane takes bytes 2 and 3 from its own copy
+		const __m256i v = _mm256_shuffle_epi8(_mm256_set1_epi32(static_cast<int>(part)), spread);
+		const __m256i f = _mm256_cmpeq_epi8(_mm256_and_si256(v, bits), bits);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(flags + 32 * half), f);
+	}
+#else
+	for (unsigned j = 0; j < 64; ++j) {
+		flags[j] = static_cast<uint8_t>(-static_cast<int>((word >> j) & 1));
+	}
+#endif
+}
+
+/// Bits pred(first) ... pred(first + size - 1), size <= 64
+/** pred runs over the elements into bytes, a loop the compiler turns into
+ *  vector compares, and the bytes are packed into bits. */
+template <typename Pred>
+uint64_t mask_word(const Pred& pred, std::size_t first, std::size_t size)
+{
+	uint8_t flags[64];
+	if (size == 64) {
+		for (unsigned j = 0; j < 64; ++j) {
+			flags[j] = static_cast<uint8_t>(-static_cast<int>(pred(first + j)));
+		}
+	} else {
+		for (unsigned j = 0; j < 64; ++j) {
+			flags[j] = static_cast<uint8_t>(j < size ? -static_cast<int>(pred(first + j)) : 0);
+		}
+	}
+	return pack_flags(flags);
+}
+
+/// mask_words(n) words of the mask of pred(i) over n elements
+template <typename Pred>
+void build_mask(std::size_t n, uint64_t* mask, const Pred& pred)
+{
+	for (std::size_t w = 0; 64 * w < n; ++w) {
+		mask[w] = mask_word(pred, 64 * w, n - 64 * w < 64 ? n - 64 * w : 64);
+	}
+}
+
+/// mask of data[i] OP threshold, mask_words(n) words, bits past n cleared
+template <comparison OP, typename A, typename B>
+typename std::enable_if<fixed_point_traits<B>::is_fixed_point>::type
+compare(const A* data, const B& threshold, std::size_t n, uint64_t* mask)
+{
+	typedef typename fixed_point_traits<A>::raw_t raw_t;
+	const threshold_compare<OP, A> test(threshold);
+	if (test.constant()) {
+		const uint64_t all = test.value() ? ~uint64_t(0) : 0;
+		for (std::size_t w = 0; 64 * w < n; ++w) {
+			mask[w] = (n - 64 * w >= 64) ? all : all >> (64 * w + 64 - n);
+		}
+		return;
+	}
+	const raw_t bound = test.bound();
+	const raw_t* raw = raw_data(data);
+	build_mask(n, mask, [raw, bound](std::size_t i) { return compare_raw<OP>(raw[i], bound); });
+}
+
+/// mask of a[i] OP b[i], for arrays of any two formats
+template <comparison OP, typename A, typename B>
+void compare(const A* a, const B* b, std::size_t n, uint64_t* mask)
+{
+	typedef common_compare_format<A, B> common;
+	const typename fixed_point_traits<A>::raw_t* ra = raw_data(a);
+	const typename fixed_point_traits<B>::raw_t* rb = raw_data(b);
+	build_mask(n, mask, [ra, rb](std::size_t i) {
+		return compare_raw<OP>(common::from_a(ra[i]), common::from_b(rb[i]));
+	});
+}
+
+/// Elements set in the mask of n elements
+inline std::size_t count(const uint64_t* mask, std::size_t n)
+{
+	std::size_t total = 0;
+	for (std::size_t w = 0; w < mask_words(n); ++w) {
+		total += popcount64(mask[w]);
+	}
+	return total;
+}
+
+/// Elements with data[i] OP threshold, without a mask
+template <comparison OP, typename A, typename B>
+std::size_t count_if(const A* data, const B& threshold, std::size_t n)
+{
+	typedef typename fixed_point_traits<A>::raw_t raw_t;
+	const threshold_compare<OP, A> test(threshold);
+	if (test.constant()) {
+		return test.value() ? n : 0;
+	}
+	const raw_t bound = test.bound();
+	const raw_t* raw = raw_data(data);
+	std::size_t total = 0;
+	for (std::size_t i = 0; i < n; ++i) {
+		total += compare_raw<OP>(raw[i], bound) ? 1 : 0;
+	}
+	return total;
+}
+
+//-----------------------------------------------------------------------------
+// SELECTION AND COMPACTION
+//-----------------------------------------------------------------------------
+
+/// out[i] = bit i of mask ? a[i] : b[i]
+/** Bitwise blend of the raw values with the mask expanded to bytes, no
+ *  branch. out may be a or b. */
+template <typename T>
+void select(const uint64_t* mask, const T* a, const T* b, T* out, std::size_t n)
+{
+	typedef typename fixed_point_traits<T>::raw_t raw_t;
+	typedef typename fixed_point_traits<T>::uraw_t uraw_t;
+	const raw_t* ra = raw_data(a);
+	const raw_t* rb = raw_data(b);
+	raw_t* ro = raw_data(out);
+	uint8_t flags[64];
+	for (std::size_t begin = 0; begin < n; begin += 64) {
+		unpack_flags(mask[begin / 64], flags);
+		const std::size_t end = n - begin < 64 ? n - begin : 64;
+		const raw_t* x = ra + begin;
+		const raw_t* y = rb + begin;
+		raw_t* o = ro + begin;
+		_FIXED_POINT_IVDEP_
+		for (std::size_t j = 0; j < end; ++j) {
+			const uraw_t pick = static_cast<uraw_t>(static_cast<int8_t>(flags[j]));
+			o[j] = static_cast<raw_t>(static_cast<uraw_t>(y[j]) ^ ((static_cast<uraw_t>(x[j]) ^ static_cast<uraw_t>(y[j])) & pick));
+		}
+	}
+}
+
+#if defined(__AVX512F__)
+/// Store the elements of in selected by word at out with vpcompress, return how many
+/** 32 and 64 bit elements need AVX-512F, 8 and 16 bit ones AVX-512 VBMI2. */
+template <std::size_t SIZE>
+struct compress_word
+{
+	static const bool available = false;
+};
+
+template <>
+struct compress_word<4>
+{
+	static const bool available = true;
+
+	static unsigned store(const void* in, uint64_t word, void* out) {
+		const int32_t* from = static_cast<const int32_t*>(in);
+		int32_t* to = static_cast<int32_t*>(out);
+		unsigned k = 0;
+		for (unsigned c = 0; c < 4; ++c) {
+			const __mmask16 m = static_cast<__mmask16>(word >> (16 * c));
+			_mm512_mask_compressstoreu_epi32(to + k, m, _mm512_loadu_si512(from + 16 * c));
+			k += popcount64(m);
+		}
+		return k;
+	}
+};
+
+template <>
+struct compress_word<8>
+{
+	static const bool available = true;
+
+	static unsigned store(const void* in, uint64_t word, void* out) {
+		const int64_t* from = static_cast<const int64_t*>(in);
+		int64_t* to = static_cast<int64_t*>(out);
+		unsigned k = 0;
+		for (unsigned c = 0; c < 8; ++c) {
+			const __mmask8 m = static_cast<__mmask8>(word >> (8 * c));
+			_mm512_mask_compressstoreu_epi64(to + k, m, _mm512_loadu_si512(from + 8 * c));
+			k += popcount64(m);
+		}
+		return k;
+	}
+};
+
+#if defined(__AVX512VBMI2__)
+template <>
+struct compress_word<2>
+{
+	static const bool available = true;
+
+	static unsigned store(const void* in, uint64_t word, void* out) {
+		const int16_t* from = static_cast<const int16_t*>(in);
+		int16_t* to = static_cast<int16_t*>(out);
+		const __mmask32 lo = static_cast<__mmask32>(word);
+		const __mmask32 hi = static_cast<__mmask32>(word >> 32);
+		_mm512_mask_compressstoreu_epi16(to, lo, _mm512_loadu_si512(from));
+		const unsigned k = popcount64(lo);
+		_mm512_mask_compressstoreu_epi16(to + k, hi, _mm512_loadu_si512(from + 32));
+		return k + popcount64(hi);
+	}
+};
+
+template <>
+struct compress_word<1>
+{
+	static const bool available = true;
+
+	static unsigned store(const void* in, uint64_t word, void* out) {
+		_mm512_mask_compressstoreu_epi8(out, static_cast<__mmask64>(word), _mm512_loadu_si512(in));
+		return popcount64(word);
+	}
+};
+#endif
+#endif
+
+/// Copy the elements of in whose mask bit is set to the front of out, in order
+/** Returns how many were copied. out may be in. Full words of 64 elements
+ *  go through vpcompress where AVX-512 has it for the size of T, the other
+ *  ones visit the set bits only, so the loop never branches on the data. */
+template <typename T>
+std::size_t compact(const T* in, const uint64_t* mask, std::size_t n, T* out)
+{
+	std::size_t k = 0;
+	std::size_t w = 0;
+#if defined(__AVX512F__)
+	if (compress_word<sizeof(T)>::available) {
+		for (; 64 * w + 64 <= n; ++w) {
+			k += compress_word<sizeof(T)>::store(in + 64 * w, mask[w], out + k);
+		}
+	}
+#endif
+	for (; w < mask_words(n); ++w) {
+		for (uint64_t word = mask[w]; word != 0; word &= word - 1) {
+			out[k++] = in[64 * w + lowest_bit(word)];
+		}
+	}
+	return k;
+}
+
+/// Copy the elements with in[i] OP threshold to the front of out, return how many
+/** A compare and a compact fused 64 elements at a time, no mask array.
+ *  out may be in. */
+template <comparison OP, typename A, typename B>
+std::size_t filter(const A* in, const B& threshold, std::size_t n, A* out)
+{
+	typedef typename fixed_point_traits<A>::raw_t raw_t;
+	const threshold_compare<OP, A> test(threshold);
+	if (test.constant()) {
+		if (!test.value()) {
+			return 0;
+		}
+		for (std::size_t i = 0; i < n && in != out; ++i) {
+			out[i] = in[i];
+		}
+		return n;
+	}
+	const raw_t bound = test.bound();
+	const raw_t* raw = raw_data(in);
+	const auto pred = [raw, bound](std::size_t i) { return compare_raw<OP>(raw[i], bound); };
+	std::size_t k = 0;
+	for (std::size_t begin = 0; begin < n; begin += 64) {
+		const std::size_t size = n - begin < 64 ? n - begin : 64;
+		const uint64_t word = mask_word(pred, begin, size);
+		k += compact(in + begin, &word, size, out + k);
+	}
+	return k;
+}
+
+} // namespace fxp
+
+#endif /* end of include guard: FIXED_POINT_MASK_HPP */
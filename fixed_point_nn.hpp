@@ -0,0 +1,512 @@
+/** Copyright 2026 Politecnico di Milano
+ * Developed by: Stefano Cherubin
+ * PhD student, Politecnico di Milano
+ * <first_name>.<family_name>@polimi.it
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIXED_POINT_NN_HPP
+#define FIXED_POINT_NN_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "fixed_point_parallel.hpp"
+#include "fixed_point_traits.hpp"
+
+namespace fxp {
+
+// Quantised neural network operators on fixed-point tensors, every layer
+// having its own input, weight and output formats. Tensors are single
+// images in channel, row, column (CHW) order; weights of a convolution are
+// in output channel, input channel, row, column order.
+//
+// Products accumulate exactly on product_accumulator of the weight and input
+// formats, and the sums are requantised once to the output format, rounding
+// to nearest and saturating like quantised inference frameworks do, with an
+// optional fused ReLU. No operator goes through floating point.
+
+//-----------------------------------------------------------------------------
+// REQUANTISATION
+//-----------------------------------------------------------------------------
+
+/// round(acc / 2^shift), ties towards plus infinity, saturated to Out
+/** Negative shifts scale up. With relu negative results become zero. */
+template <typename Out, typename acc_t>
+Out requantize(acc_t acc, int shift, bool relu = false)
+{
+	typedef fixed_point_traits<Out> traits;
+	if (shift > 0) {
+		acc = (acc + (static_cast<acc_t>(1) << (shift - 1))) >> shift;
+	} else if (shift < 0) {
+		acc = acc * (static_cast<acc_t>(1) << -shift);
+	}
+	const acc_t max = static_cast<acc_t>(traits::max_raw());
+	const acc_t min = relu ? acc_t(0) : static_cast<acc_t>(traits::min_raw());
+	return Out::createRaw(static_cast<typename traits::raw_t>(acc < min ? min : acc > max ? max : acc));
+}
+
+/// Raw value of b with frac_bits fractional bits, truncated
+template <typename acc_t, typename B>
+acc_t align_raw(const B& b, int frac_bits)
+{
+	const int shift = frac_bits - fixed_point_traits<B>::fractional_length;
+	const acc_t raw = static_cast<acc_t>(b.getRaw());
+	return shift >= 0 ? raw * (static_cast<acc_t>(1) << shift) : raw >> -shift;
+}
+
+//-----------------------------------------------------------------------------
+// CONVOLUTION
+//-----------------------------------------------------------------------------
+
+/// Shape of a 2D convolution or pooling window
+struct conv2d_params
+{
+	std::size_t in_channels;
+	std::size_t in_height;
+	std::size_t in_width;
+	std::size_t out_channels;
+	std::size_t kernel_height;
+	std::size_t kernel_width;
+	std::size_t stride_height;
+	std::size_t stride_width;
+	std::size_t pad_height;
+	std::size_t pad_width;
+	/// Clamp negative outputs to zero
+	bool relu;
+
+	conv2d_params(std::size_t in_channels, std::size_t in_height, std::size_t in_width,
+		std::size_t out_channels, std::size_t kernel_height, std::size_t kernel_width,
+		std::size_t stride = 1, std::size_t pad = 0, bool relu = false)
+		: in_channels(in_channels), in_height(in_height), in_width(in_width),
+		  out_channels(out_channels), kernel_height(kernel_height), kernel_width(kernel_width),
+		  stride_height(stride), stride_width(stride), pad_height(pad), pad_width(pad), relu(relu) {}
+
+	std::size_t out_height() const { return (in_height + 2 * pad_height - kernel_height) / stride_height + 1; }
+	std::size_t out_width() const { return (in_width + 2 * pad_width - kernel_width) / stride_width + 1; }
+
+	/// Output columns [first, last) whose input column ox * stride + kx - pad is in the input
+	void valid_columns(std::size_t kx, std::size_t& first, std::size_t& last) const {
+		first = kx >= pad_width ? 0 : (pad_width - kx + stride_width - 1) / stride_width;
+		last = in_width + pad_width > kx ? (in_width + pad_width - kx - 1) / stride_width + 1 : 0;
+		last = last < out_width() ? last : out_width();
+		first = first < last ? first : last;
+	}
+};
+
+/// Bias of each output channel aligned to the accumulator, zero without bias
+template <typename acc_t, typename B>
+std::vector<acc_t> aligned_bias(const B* bias, std::size_t channels, int frac_bits)
+{
+	std::vector<acc_t> result(channels, acc_t(0));
+	if (bias != nullptr) {
+		for (std::size_t c = 0; c < channels; ++c) {
+			result[c] = align_raw<acc_t>(bias[c], frac_bits);
+		}
+	}
+	return result;
+}
+
+/// sums += the plane in convolved with the kernel_height x kernel_width kernel w
+template <typename In, typename Wt, typename acc_t>
+void conv2d_accumulate_plane(const conv2d_params& p, const In* in, const Wt* w, acc_t* sums)
+{
+	const std::size_t oh = p.out_height(), ow = p.out_width();
+	for (std::size_t ky = 0; ky < p.kernel_height; ++ky) {
+		for (std::size_t kx = 0; kx < p.kernel_width; ++kx) {
+			const acc_t wk = w[ky * p.kernel_width + kx].getRaw();
+			std::size_t first, last;
+			p.valid_columns(kx, first, last);
+			if (first == last) {
+				continue;
+			}
+			for (std::size_t oy = 0; oy < oh; ++oy) {
+				const std::size_t iy = oy * p.stride_height + ky;
+				if (iy < p.pad_height || iy - p.pad_height >= p.in_height) {
+					continue;
+				}
+				// input column of output column first, not before the row
+				const In* row = in + (iy - p.pad_height) * p.in_width + first * p.stride_width + kx - p.pad_width;
+				acc_t* s = sums + oy * ow + first;
+				const std::size_t count = last - first;
+				const std::size_t stride = p.stride_width;
+				_FIXED_POINT_IVDEP_
+				for (std::size_t j = 0; j < count; ++j) {
+					s[j] += wk * static_cast<acc_t>(row[j * stride].getRaw());
+				}
+			}
+		}
+	}
+}
+
+/// Convolution by im2col and a tiled matrix product
+/** Output pixels are processed in tiles of tile pixels split among the
+ *  threads: each tile builds its im2col block of in_channels * kernel
+ *  rows, which stays in cache while every output channel is accumulated
+ *  on it along the pixels of the tile. bias may be null. */
+template <typename In, typename Wt, typename B, typename Out>
+void conv2d_im2col(const conv2d_params& p, const In* input, const Wt* weights, const B* bias,
+	Out* output, std::size_t tile = 128)
+{
+	typedef product_accumulator<Wt, In> accumulator;
+	typedef typename accumulator::acc_t acc_t;
+	typedef typename fixed_point_traits<In>::raw_t in_raw_t;
+	const int shift = accumulator::frac_bits - fixed_point_traits<Out>::fractional_length;
+	const std::size_t oh = p.out_height(), ow = p.out_width();
+	const std::size_t pixels = oh * ow;
+	const std::size_t depth = p.in_channels * p.kernel_height * p.kernel_width;
+	const std::vector<acc_t> bias_acc = aligned_bias<acc_t>(bias, p.out_channels, accumulator::frac_bits);
+	if (tile == 0) {
+		tile = 1;
+	}
+
+	parallel_for((pixels + tile - 1) / tile, [&](std::size_t begin, std::size_t end) {
+		std::vector<in_raw_t> col(depth * tile);
+		std::vector<acc_t> sums(tile);
+		for (std::size_t t = begin; t < end; ++t) {
+			const std::size_t p0 = t * tile;
+			const std::size_t np = p0 + tile < pixels ? tile : pixels - p0;
+			for (std::size_t k = 0; k < depth; ++k) {
+				const std::size_t ic = k / (p.kernel_height * p.kernel_width);
+				const std::size_t ky = k / p.kernel_width % p.kernel_height;
+				const std::size_t kx = k % p.kernel_width;
+				for (std::size_t j = 0; j < np; ++j) {
+					const std::size_t oy = (p0 + j) / ow, ox = (p0 + j) % ow;
+					const std::size_t iy = oy * p.stride_height + ky, ix = ox * p.stride_width + kx;
+					const bool inside = iy >= p.pad_height && iy - p.pad_height < p.in_height
+						&& ix >= p.pad_width && ix - p.pad_width < p.in_width;
+					col[k * tile + j] = inside
+						? input[(ic * p.in_height + iy - p.pad_height) * p.in_width + ix - p.pad_width].getRaw()
+						: in_raw_t(0);
+				}
+			}
+			for (std::size_t oc = 0; oc < p.out_channels; ++oc) {
+				acc_t* s = sums.data();
+				for (std::size_t j = 0; j < np; ++j) {
+					s[j] = bias_acc[oc];
+				}
+				const Wt* w = weights + oc * depth;
+				for (std::size_t k = 0; k < depth; ++k) {
+					const acc_t wk = w[k].getRaw();
+					const in_raw_t* c = col.data() + k * tile;
+					_FIXED_POINT_IVDEP_
+					for (std::size_t j = 0; j < np; ++j) {
+						s[j] += wk * static_cast<acc_t>(c[j]);
+					}
+				}
+				Out* out = output + oc * pixels + p0;
+				for (std::size_t j = 0; j < np; ++j) {
+					out[j] = requantize<Out>(s[j], shift, p.relu);
+				}
+			}
+		}
+	}, 1);
+}
+
+/// Convolution by im2col without bias
+template <typename In, typename Wt, typename Out>
+void conv2d_im2col(const conv2d_params& p, const In* input, const Wt* weights, Out* output, std::size_t tile = 128)
+{
+	conv2d_im2col(p, input, weights, static_cast<const Out*>(nullptr), output, tile);
+}
+
+/// Direct convolution, without the im2col buffer
+/** Output channels are split among the threads; each accumulates its whole
+ *  output plane, one kernel tap at a time along contiguous input rows.
+ *  bias may be null. */
+template <typename In, typename Wt, typename B, typename Out>
+void conv2d_direct(const conv2d_params& p, const In* input, const Wt* weights, const B* bias, Out* output)
+{
+	typedef product_accumulator<Wt, In> accumulator;
+	typedef typename accumulator::acc_t acc_t;
+	const int shift = accumulator::frac_bits - fixed_point_traits<Out>::fractional_length;
+	const std::size_t oh = p.out_height(), ow = p.out_width();
+	const std::vector<acc_t> bias_acc = aligned_bias<acc_t>(bias, p.out_channels, accumulator::frac_bits);
+
+	parallel_for(p.out_channels, [&](std::size_t begin, std::size_t end) {
+		std::vector<acc_t> sums(oh * ow);
+		for (std::size_t oc = begin; oc < end; ++oc) {
+			std::fill(sums.begin(), sums.end(), bias_acc[oc]);
+			for (std::size_t ic = 0; ic < p.in_channels; ++ic) {
+				conv2d_accumulate_plane(p, input + ic * p.in_height * p.in_width,
+					weights + (oc * p.in_channels + ic) * p.kernel_height * p.kernel_width, sums.data());
+			}
+			Out* out = output + oc * oh * ow;
+			for (std::size_t i = 0; i < oh * ow; ++i) {
+				out[i] = requantize<Out>(sums[i], shift, p.relu);
+			}
+		}
+	}, 1);
+}
+
+/// Direct convolution without bias
+template <typename In, typename Wt, typename Out>
+void conv2d_direct(const conv2d_params& p, const In* input, const Wt* weights, Out* output)
+{
+	conv2d_direct(p, input, weights, static_cast<const Out*>(nullptr), output);
+}
+
+/// Depthwise convolution, one kernel_height x kernel_width kernel per channel
+/** p.out_channels must equal p.in_channels; weights are in channel, row,
+ *  column order. Channels are split among the threads. bias may be null. */
+template <typename In, typename Wt, typename B, typename Out>
+void depthwise_conv2d(const conv2d_params& p, const In* input, const Wt* weights, const B* bias, Out* output)
+{
+	typedef product_accumulator<Wt, In> accumulator;
+	typedef typename accumulator::acc_t acc_t;
+	const int shift = accumulator::frac_bits - fixed_point_traits<Out>::fractional_length;
+	const std::size_t oh = p.out_height(), ow = p.out_width();
+	const std::vector<acc_t> bias_acc = aligned_bias<acc_t>(bias, p.in_channels, accumulator::frac_bits);
+
+	parallel_for(p.in_channels, [&](std::size_t begin, std::size_t end) {
+		std::vector<acc_t> sums(oh * ow);
+		for (std::size_t c = begin; c < end; ++c) {
+			std::fill(sums.begin(), sums.end(), bias_acc[c]);
+			conv2d_accumulate_plane(p, input + c * p.in_height * p.in_width,
+				weights + c * p.kernel_height * p.kernel_width, sums.data());
+			Out* out = output + c * oh * ow;
+			for (std::size_t i = 0; i < oh * ow; ++i) {
+				out[i] = requantize<Out>(sums[i], shift, p.relu);
+			}
+		}
+	}, 1);
+}
+
+/// Depthwise convolution without bias
+template <typename In, typename Wt, typename Out>
+void depthwise_conv2d(const conv2d_params& p, const In* input, const Wt* weights, Out* output)
+{
+	depthwise_conv2d(p, input, weights, static_cast<const Out*>(nullptr), output);
+}
+
+//-----------------------------------------------------------------------------
+// POOLING
+//-----------------------------------------------------------------------------
+
+/// Largest value of each window of each channel, padding excluded
+/** Uses the in_channels, input size, kernel, stride and padding of p. */
+template <typename T>
+void max_pool2d(const conv2d_params& p, const T* input, T* output)
+{
+	const std::size_t oh = p.out_height(), ow = p.out_width();
+	parallel_for(p.in_channels, [&](std::size_t begin, std::size_t end) {
+		for (std::size_t c = begin; c < end; ++c) {
+			const T* in = input + c * p.in_height * p.in_width;
+			for (std::size_t oy = 0; oy < oh; ++oy) {
+				for (std::size_t ox = 0; ox < ow; ++ox) {
+					bool found = false;
+					T best = T::createRaw(0);
+					for (std::size_t ky = 0; ky < p.kernel_height; ++ky) {
+						const std::size_t iy = oy * p.stride_height + ky;
+						if (iy < p.pad_height || iy - p.pad_height >= p.in_height) {
+							continue;
+						}
+						for (std::size_t kx = 0; kx < p.kernel_width; ++kx) {
+							const std::size_t ix = ox * p.stride_width + kx;
+							if (ix < p.pad_width || ix - p.pad_width >= p.in_width) {
+								continue;
+							}
+							const T v = in[(iy - p.pad_height) * p.in_width + ix - p.pad_width];
+							if (!found || v.getRaw() > best.getRaw()) {
+								best = v;
+								found = true;
+							}
+						}
+					}
+					output[(c * oh + oy) * ow + ox] = best;
+				}
+			}
+		}
+	}, 1);
+}
+
+/// Mean of each window of each channel, padding excluded, rounded to nearest
+template <typename T>
+void avg_pool2d(const conv2d_params& p, const T* input, T* output)
+{
+	typedef typename product_accumulator<T, T>::acc_t acc_t;
+	const std::size_t oh = p.out_height(), ow = p.out_width();
+	parallel_for(p.in_channels, [&](std::size_t begin, std::size_t end) {
+		for (std::size_t c = begin; c < end; ++c) {
+			const T* in = input + c * p.in_height * p.in_width;
+			for (std::size_t oy = 0; oy < oh; ++oy) {
+				for (std::size_t ox = 0; ox < ow; ++ox) {
+					acc_t sum = 0;
+					acc_t count = 0;
+					for (std::size_t ky = 0; ky < p.kernel_height; ++ky) {
+						const std::size_t iy = oy * p.stride_height + ky;
+						if (iy < p.pad_height || iy - p.pad_height >= p.in_height) {
+							continue;
+						}
+						for (std::size_t kx = 0; kx < p.kernel_width; ++kx) {
+							const std::size_t ix = ox * p.stride_width + kx;
+							if (ix < p.pad_width || ix - p.pad_width >= p.in_width) {
+								continue;
+							}
+							sum += static_cast<acc_t>(in[(iy - p.pad_height) * p.in_width + ix - p.pad_width].getRaw());
+							++count;
+						}
+					}
+					// half away from zero
+					const acc_t mean = count == 0 ? acc_t(0)
+						: sum >= 0 ? (sum + count / 2) / count : -((-sum + count / 2) / count);
+					output[(c * oh + oy) * ow + ox] = T::createRaw(static_cast<typename fixed_point_traits<T>::raw_t>(mean));
+				}
+			}
+		}
+	}, 1);
+}
+
+//-----------------------------------------------------------------------------
+// SOFTMAX
+//-----------------------------------------------------------------------------
+
+/// 2^-x for x >= 0, both with 30 fractional bits
+/** 2^-x = 2^(1 - r) / 2^(q + 1) with x = q + r, 0 <= r < 1; 2^f on (0, 1]
+ *  is the degree 7 Taylor polynomial of exp(f ln 2), within 2e-6. */
+inline int64_t exp2_neg_q30(int64_t x)
+{
+	static const int64_t one = int64_t(1) << 30;
+	// (ln 2)^k / k!, 30 fractional bits
+	static const int64_t c[8] = {
+		1073741824, 744261118, 257941007, 59597541,
+		10327324, 1431647, 165389, 16377
+	};
+	const int64_t q = x >> 30;
+	if (q >= 30) {
+		return 0;
+	}
+	const int64_t f = one - (x & (one - 1));
+	int64_t acc = c[7];
+	for (int k = 6; k >= 0; --k) {
+		acc = ((acc * f) >> 30) + c[k];
+	}
+	return acc >> (q + 1);
+}
+
+/// out = softmax(in) over each of the rows rows of n elements
+/** exp(x - max) is computed as a power of two with integer arithmetic on 30
+ *  fractional bits, the row is normalised with one integer division, and
+ *  probabilities are rounded to Out and saturated, so 1 becomes the
+ *  largest value of formats like fixed_point_t<1, 15>. Rows are split among
+ *  the threads. In has at most 32 bits. */
+template <typename In, typename Out>
+void softmax(const In* in, Out* out, std::size_t rows, std::size_t n)
+{
+	static_assert(fixed_point_traits<In>::bit_width <= 32, "softmax inputs have at most 32 bits");
+	static const int frac_in = fixed_point_traits<In>::fractional_length;
+	static const int frac_out = fixed_point_traits<Out>::fractional_length;
+	// log2(e), 30 fractional bits
+	static const int64_t log2e_q30 = 1549082005;
+	if (n == 0) {
+		return;
+	}
+
+	parallel_for(rows, [=](std::size_t begin, std::size_t end) {
+		std::vector<int64_t> e(n);
+		for (std::size_t r = begin; r < end; ++r) {
+			const In* x = in + r * n;
+			int64_t max = x[0].getRaw();
+			for (std::size_t i = 1; i < n; ++i) {
+				max = x[i].getRaw() > max ? static_cast<int64_t>(x[i].getRaw()) : max;
+			}
+			uint64_t sum = 0;
+			for (std::size_t i = 0; i < n; ++i) {
+				// (max - x) log2(e), 30 fractional bits
+				const uint64_t d = static_cast<uint64_t>(max - x[i].getRaw());
+				const uint64_t scaled = (d >> frac_in) * log2e_q30
+					+ (((d & ((uint64_t(1) << frac_in) - 1)) * log2e_q30) >> frac_in);
+				e[i] = scaled >= (uint64_t(31) << 30) ? 0 : exp2_neg_q30(static_cast<int64_t>(scaled));
+				sum += static_cast<uint64_t>(e[i]);
+			}
+			// p = e / sum with 32 fractional bits; the largest e is 2^30, so sum >= 2^30
+			const int64_t inv = static_cast<int64_t>((uint64_t(1) << 62) / sum);
+			Out* y = out + r * n;
+			for (std::size_t i = 0; i < n; ++i) {
+				y[i] = requantize<Out>((e[i] * inv) >> 30, 32 - frac_out);
+			}
+		}
+	}, 1);
+}
+
+//-----------------------------------------------------------------------------
+// LAYER NORMALISATION
+//-----------------------------------------------------------------------------
+
+/// out = gamma * (x - mean) / sqrt(var + epsilon) + beta over each of the rows rows of n elements
+/** Mean and variance are exact sums divided once by n; the standard
+ *  deviation is an integer square root, with the format of In, and every
+ *  normalised value an integer division by it with 30 fractional bits.
+ *  epsilon is added to the variance, i.e. it is in the square of the units
+ *  of In. The affine output is requantised once to Out. Rows are split
+ *  among the threads. */
+template <typename In, typename G, typename Bt, typename Out>
+void layernorm(const In* in, const G* gamma, const Bt* beta, Out* out,
+	std::size_t rows, std::size_t n, const In& epsilon)
+{
+	typedef product_accumulator<In, In> accumulator;
+	typedef typename accumulator::acc_t acc_t;
+	typedef typename get_uint_with_length<accumulator::bits>::RESULT uacc_t;
+	static const int frac_in = fixed_point_traits<In>::fractional_length;
+	static const int frac_g = fixed_point_traits<G>::fractional_length;
+	// gamma (bit_width bits) times y (at most 30 fractional bits and log2(n) / 2 < 32 integer bits)
+	static const uint16_t affine_bits = fixed_point_traits<G>::bit_width + 64 < 128 ? fixed_point_traits<G>::bit_width + 64 : 128;
+	typedef typename get_int_with_length<affine_bits>::RESULT affine_t;
+	static const int frac_y = 30;
+	// centred values shifted by frac_y before the division by sigma
+	static const uint16_t norm_bits = fixed_point_traits<In>::bit_width + frac_y + 2 < 64 ? 64 : 128;
+	typedef typename get_int_with_length<norm_bits>::RESULT norm_t;
+
+	parallel_for(rows, [=](std::size_t begin, std::size_t end) {
+		std::vector<acc_t> centred(n);
+		for (std::size_t r = begin; r < end; ++r) {
+			const In* x = in + r * n;
+			acc_t sum = 0;
+			for (std::size_t i = 0; i < n; ++i) {
+				sum += static_cast<acc_t>(x[i].getRaw());
+			}
+			const acc_t count = static_cast<acc_t>(n);
+			const acc_t mean = sum >= 0 ? sum / count : -((-sum + count - 1) / count);
+			acc_t squares = 0;
+			for (std::size_t i = 0; i < n; ++i) {
+				centred[i] = static_cast<acc_t>(x[i].getRaw()) - mean;
+				squares += centred[i] * centred[i];
+			}
+			// variance with 2 * frac_in fractional bits
+			const uacc_t variance = static_cast<uacc_t>(squares / count)
+				+ (static_cast<uacc_t>(static_cast<acc_t>(epsilon.getRaw())) << frac_in);
+			acc_t sigma = static_cast<acc_t>(isqrt(variance));
+			sigma = sigma > 0 ? sigma : 1;
+			Out* y = out + r * n;
+			for (std::size_t i = 0; i < n; ++i) {
+				const affine_t normalised = static_cast<affine_t>(
+					static_cast<norm_t>(centred[i]) * (static_cast<norm_t>(1) << frac_y) / static_cast<norm_t>(sigma));
+				const affine_t scaled = normalised * static_cast<affine_t>(gamma[i].getRaw())
+					+ align_raw<affine_t>(beta[i], frac_g + frac_y);
+				y[i] = requantize<Out>(scaled, frac_g + frac_y - fixed_point_traits<Out>::fractional_length);
+			}
+		}
+	}, 1);
+}
+
+} // namespace fxp
+
+#endif /* end of include guard: FIXED_POINT_NN_HPP */
@@ -0,0 +1,112 @@
+/** Copyright 2026 Politecnico di Milano
+ * Developed by: Stefano Cherubin
+ * PhD student, Politecnico di Milano
+ * <first_name>.<family_name>@polimi.it
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIXED_POINT_PARALLEL_HPP
+#define FIXED_POINT_PARALLEL_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace fxp {
+
+//-----------------------------------------------------------------------------
+// THREAD POOL SIZING
+//-----------------------------------------------------------------------------
+
+/// Minimum number of elements assigned to a worker thread by default
+const std::size_t default_grain = 1 << 15;
+
+inline std::atomic<unsigned>& thread_limit() {
+	static std::atomic<unsigned> limit(0);
+	return limit;
+}
+
+/// Limit the number of threads used by the parallel algorithms
+/** \param threads Upper bound, 0 restores the number of hardware threads */
+inline void set_thread_count(unsigned threads) {
+	thread_limit().store(threads, std::memory_order_relaxed);
+}
+
+/// Number of threads used by the parallel algorithms
+inline unsigned thread_count() {
+	const unsigned limit = thread_limit().load(std::memory_order_relaxed);
+	if (limit > 0) {
+		return limit;
+	}
+	const unsigned hw = std::thread::hardware_concurrency();
+	return hw > 0 ? hw : 1;
+}
+
+//-----------------------------------------------------------------------------
+// WORK SPLITTING
+//-----------------------------------------------------------------------------
+
+/// Number of chunks [0, n) is split into, so that each one has at least grain elements
+inline std::size_t chunk_count(std::size_t n, std::size_t grain = default_grain) {
+	std::size_t chunks = grain > 0 ? n / grain : n;
+	if (chunks > thread_count()) {
+		chunks = thread_count();
+	}
+	return chunks > 0 ? chunks : 1;
+}
+
+/// First element of the given chunk; chunk == chunks returns n
+inline std::size_t chunk_begin(std::size_t n, std::size_t chunks, std::size_t chunk) {
+	const std::size_t base = n / chunks;
+	const std::size_t extra = n % chunks;
+	return base * chunk + (chunk < extra ? chunk : extra);
+}
+
+/// Run fn(chunk, begin, end) for each of the chunks [0, n) is split into
+/** Chunks are contiguous and ordered, chunk 0 runs on the calling thread and
+ *  the call returns when every chunk is done. */
+template <typename Fn>
+void parallel_chunks(std::size_t n, std::size_t chunks, Fn fn) {
+	if (chunks <= 1) {
+		fn(static_cast<std::size_t>(0), static_cast<std::size_t>(0), n);
+		return;
+	}
+	std::vector<std::thread> workers;
+	workers.reserve(chunks - 1);
+	for (std::size_t c = 1; c < chunks; ++c) {
+		workers.push_back(std::thread(fn, c, chunk_begin(n, chunks, c), chunk_begin(n, chunks, c + 1)));
+	}
+	fn(static_cast<std::size_t>(0), static_cast<std::size_t>(0), chunk_begin(n, chunks, 1));
+	for (std::size_t c = 0; c < workers.size(); ++c) {
+		workers[c].join();
+	}
+}
+
+/// Run fn(begin, end) over [0, n) split among the available threads
+template <typename Fn>
+void parallel_for(std::size_t n, Fn fn, std::size_t grain = default_grain) {
+	parallel_chunks(n, chunk_count(n, grain),
+		[&fn](std::size_t, std::size_t begin, std::size_t end) { fn(begin, end); });
+}
+
+} // namespace fxp
+
+#endif /* end of include guard: FIXED_POINT_PARALLEL_HPP */
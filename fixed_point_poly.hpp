@@ -0,0 +1,415 @@
+/** Copyright 2026 Politecnico di Milano
+ * Developed by: Stefano Cherubin
+ * PhD student, Politecnico di Milano
+ * <first_name>.<family_name>@polimi.it
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIXED_POINT_POLY_HPP
+#define FIXED_POINT_POLY_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include "fixed_point_traits.hpp"
+
+namespace fxp {
+
+//-----------------------------------------------------------------------------
+// POLYNOMIAL EVALUATION
+//-----------------------------------------------------------------------------
+
+/// Nearest value of T to the real value, ties away from zero
+template <typename T>
+T round_to_format(long double value)
+{
+	const long double scaled = std::ldexp(value, fixed_point_traits<T>::fractional_length);
+	return T::createRaw(static_cast<typename fixed_point_traits<T>::raw_t>(
+		scaled < 0 ? -std::floor(-scaled + 0.5L) : std::floor(scaled + 0.5L)));
+}
+
+/// Polynomial c0 + c1 x + ... + cN x^N with one format per coefficient
+/** Formats lists the format of c0 first. Every step of the evaluation keeps
+ *  the format of the coefficient it adds: Horner computes
+ *  acc(k) = acc(k+1) * x + c(k) with acc(k) in the format of c(k), the exact
+ *  product being truncated once to that format by multiply_to, so the
+ *  formats can follow the magnitude of the partial sums instead of sharing
+ *  the worst case one. The value of the polynomial has the format of c0.
+ *
+ *  Estrin evaluates the same polynomial as a balanced tree: the partial
+ *  polynomial of c(lo)..c(hi) has the format of c(lo) and the powers
+ *  x^2, x^4, ... are computed in the format of x. It exposes more
+ *  independent multiplications to a single evaluation, while Horner gives
+ *  the smaller error and the batch functions already work on many elements
+ *  at once.
+ *
+ *  Example: poly< fixed_point_t<2,30>, fixed_point_t<1,31>, fixed_point_t<1,31> > */
+template <typename... Formats>
+struct poly
+{
+	static_assert(sizeof...(Formats) > 0, "a polynomial needs at least one coefficient");
+
+	/// Number of coefficients
+	static const std::size_t size = sizeof...(Formats);
+	/// Degree of the polynomial
+	static const std::size_t degree = sizeof...(Formats) - 1;
+
+	/// Format of the coefficient of x^K
+	template <std::size_t K>
+	struct format { typedef typename std::tuple_element<K, std::tuple<Formats...> >::type RESULT; };
+
+	typedef typename format<0>::RESULT result_t;
+
+	std::tuple<Formats...> coefficients;
+
+	poly() = default;
+
+	poly(const Formats&... c) : coefficients(c...) {}
+
+	/// Coefficients rounded to nearest from the first size values of c
+	explicit poly(const long double* c) { quantize<0>(c, std::integral_constant<bool, size == 0>()); }
+
+	/// Coefficients rounded to nearest from c, which has size values
+	/** Throws std::invalid_argument for another number of values. */
+	explicit poly(const std::vector<long double>& c) : poly(checked_values(c)) {}
+
+	/// Coefficient of x^K
+	template <std::size_t K>
+	typename format<K>::RESULT& coefficient() { return std::get<K>(coefficients); }
+
+	template <std::size_t K>
+	const typename format<K>::RESULT& coefficient() const { return std::get<K>(coefficients); }
+
+	/// Value of the coefficients as real numbers
+	std::vector<long double> values() const {
+		std::vector<long double> result(size);
+		store_values<0>(result.data(), std::integral_constant<bool, size == 0>());
+		return result;
+	}
+
+	//-------------------------------------------------------------------------
+	// SCALAR EVALUATION
+
+	/// Horner evaluation
+	template <typename X>
+	result_t horner(const X& x) const {
+		return horner_step<0>(x, std::integral_constant<bool, degree == 0>());
+	}
+
+	template <typename X>
+	result_t operator()(const X& x) const { return horner(x); }
+
+	/// Estrin evaluation
+	template <typename X>
+	result_t estrin(const X& x) const {
+		return estrin_step<0, size>(x);
+	}
+
+	//-------------------------------------------------------------------------
+	// BATCH EVALUATION
+
+	/// out[i] = p(in[i]) by Horner, vectorised across the elements
+	/** out may alias in when X and result_t are the same type. */
+	template <typename X>
+	void horner(const X* in, result_t* out, std::size_t n) const {
+		const poly p = *this;
+		_FIXED_POINT_IVDEP_
+		for (std::size_t i = 0; i < n; ++i) {
+			out[i] = p.horner(in[i]);
+		}
+	}
+
+	template <typename X>
+	void operator()(const X* in, result_t* out, std::size_t n) const { horner(in, out, n); }
+
+	/// out[i] = p(in[i]) by Estrin
+	template <typename X>
+	void estrin(const X* in, result_t* out, std::size_t n) const {
+		const poly p = *this;
+		_FIXED_POINT_IVDEP_
+		for (std::size_t i = 0; i < n; ++i) {
+			out[i] = p.estrin(in[i]);
+		}
+	}
+
+private:
+	static const long double* checked_values(const std::vector<long double>& c) {
+		if (c.size() != size) {
+			throw std::invalid_argument("fxp::poly: wrong number of coefficients");
+		}
+		return c.data();
+	}
+
+	template <std::size_t K>
+	void quantize(const long double*, std::true_type) {}
+
+	template <std::size_t K>
+	void quantize(const long double* c, std::false_type) {
+		std::get<K>(coefficients) = round_to_format<typename format<K>::RESULT>(c[K]);
+		quantize<K + 1>(c, std::integral_constant<bool, K + 1 == size>());
+	}
+
+	template <std::size_t K>
+	void store_values(long double*, std::true_type) const {}
+
+	template <std::size_t K>
+	void store_values(long double* c, std::false_type) const {
+		c[K] = std::get<K>(coefficients).getValueFLD();
+		store_values<K + 1>(c, std::integral_constant<bool, K + 1 == size>());
+	}
+
+	// acc(K) = acc(K+1) * x + c(K), in the format of c(K)
+	template <std::size_t K, typename X>
+	typename format<K>::RESULT horner_step(const X&, std::true_type) const {
+		return std::get<K>(coefficients);
+	}
+
+	template <std::size_t K, typename X>
+	typename format<K>::RESULT horner_step(const X& x, std::false_type) const {
+		typedef typename format<K>::RESULT acc_t;
+		return multiply_to<acc_t>(horner_step<K + 1>(x, std::integral_constant<bool, K + 1 == degree>()), x)
+			+ std::get<K>(coefficients);
+	}
+
+	// x^(2^L) in the format of x
+	template <std::size_t POW, typename X>
+	static X power(const X& x, std::true_type) { return x; }
+
+	template <std::size_t POW, typename X>
+	static X power(const X& x, std::false_type) {
+		const X half = power<POW / 2>(x, std::integral_constant<bool, POW / 2 == 1>());
+		return multiply_to<X>(half, half);
+	}
+
+	// Largest power of two lower than N, for N > 1
+	static constexpr std::size_t split(std::size_t n, std::size_t p = 1) {
+		return 2 * p >= n ? p : split(n, 2 * p);
+	}
+
+	// c(LO) + ... + c(LO+N-1) x^(N-1), in the format of c(LO)
+	template <std::size_t LO, std::size_t N, typename X>
+	typename format<LO>::RESULT estrin_step(const X& x) const {
+		return estrin_split<LO, N>(x, std::integral_constant<bool, N == 1>());
+	}
+
+	template <std::size_t LO, std::size_t N, typename X>
+	typename format<LO>::RESULT estrin_split(const X&, std::true_type) const {
+		return std::get<LO>(coefficients);
+	}
+
+	template <std::size_t LO, std::size_t N, typename X>
+	typename format<LO>::RESULT estrin_split(const X& x, std::false_type) const {
+		typedef typename format<LO>::RESULT acc_t;
+		static const std::size_t H = split(N);
+		return estrin_step<LO, H>(x)
+			+ multiply_to<acc_t>(estrin_step<LO + H, N - H>(x), power<H>(x, std::integral_constant<bool, H == 1>()));
+	}
+};
+
+//-----------------------------------------------------------------------------
+// MINIMAX APPROXIMATION
+//-----------------------------------------------------------------------------
+
+/// Polynomial approximation fitted by minimax_fit
+struct minimax_result
+{
+	/// Coefficients, constant term first
+	std::vector<long double> coefficients;
+	/// Largest absolute error over the fitting interval
+	long double max_error;
+	/// Remez iterations performed
+	unsigned iterations;
+};
+
+/// Solve a x = b in place by Gaussian elimination with partial pivoting
+/** a is n x n in row-major order, b receives x. */
+inline bool solve_linear(std::vector<long double>& a, std::vector<long double>& b, std::size_t n)
+{
+	for (std::size_t col = 0; col < n; ++col) {
+		std::size_t pivot = col;
+		for (std::size_t row = col + 1; row < n; ++row) {
+			if (std::fabs(a[row * n + col]) > std::fabs(a[pivot * n + col])) {
+				pivot = row;
+			}
+		}
+		if (a[pivot * n + col] == 0) {
+			return false;
+		}
+		if (pivot != col) {
+			for (std::size_t k = 0; k < n; ++k) {
+				std::swap(a[col * n + k], a[pivot * n + k]);
+			}
+			std::swap(b[col], b[pivot]);
+		}
+		for (std::size_t row = col + 1; row < n; ++row) {
+			const long double factor = a[row * n + col] / a[col * n + col];
+			for (std::size_t k = col; k < n; ++k) {
+				a[row * n + k] -= factor * a[col * n + k];
+			}
+			b[row] -= factor * b[col];
+		}
+	}
+	for (std::size_t col = n; col-- > 0; ) {
+		for (std::size_t k = col + 1; k < n; ++k) {
+			b[col] -= a[col * n + k] * b[k];
+		}
+		b[col] /= a[col * n + col];
+	}
+	return true;
+}
+
+/// Value of the polynomial with real coefficients c, constant term first
+inline long double poly_value(const std::vector<long double>& c, long double x)
+{
+	long double acc = 0;
+	for (std::size_t k = c.size(); k-- > 0; ) {
+		acc = acc * x + c[k];
+	}
+	return acc;
+}
+
+/// Minimax polynomial of the given degree approximating f over [lo, hi]
+/** Remez exchange algorithm in long double: starting from the Chebyshev
+ *  extrema, it alternates solving for the polynomial that equioscillates on
+ *  degree + 2 reference points and moving the references to the extrema of
+ *  the error, found on a grid of samples points, until the largest error is
+ *  within tolerance of the levelled one. The coefficients are in the
+ *  monomial basis, so high degrees on wide intervals are ill-conditioned;
+ *  map the interval to [-1, 1] or [0, 1] first. */
+template <typename F>
+minimax_result minimax_fit(F f, std::size_t degree, long double lo, long double hi,
+	unsigned max_iterations = 32, std::size_t samples = 4096, long double tolerance = 1e-6L)
+{
+	const std::size_t n = degree + 2;
+	const long double pi = 3.141592653589793238462643383279502884L;
+	if (samples < 8 * n) {
+		samples = 8 * n;
+	}
+
+	std::vector<long double> ref(n);
+	for (std::size_t i = 0; i < n; ++i) {
+		ref[i] = (lo + hi) / 2 - (hi - lo) / 2 * std::cos(pi * i / (n - 1));
+	}
+
+	std::vector<long double> grid(samples);
+	std::vector<long double> target(samples);
+	for (std::size_t i = 0; i < samples; ++i) {
+		grid[i] = lo + (hi - lo) * i / (samples - 1);
+		target[i] = f(grid[i]);
+	}
+
+	minimax_result result;
+	result.coefficients.assign(degree + 1, 0);
+	result.max_error = 0;
+	result.iterations = 0;
+
+	std::vector<long double> a(n * n);
+	std::vector<long double> b(n);
+	std::vector<long double> err(samples);
+	std::vector<long double> extrema;
+
+	for (unsigned it = 0; it < max_iterations; ++it) {
+		// p(ref[i]) + (-1)^i E = f(ref[i])
+		for (std::size_t i = 0; i < n; ++i) {
+			long double power = 1;
+			for (std::size_t k = 0; k <= degree; ++k) {
+				a[i * n + k] = power;
+				power *= ref[i];
+			}
+			a[i * n + degree + 1] = (i % 2 == 0) ? 1 : -1;
+			b[i] = f(ref[i]);
+		}
+		if (!solve_linear(a, b, n)) {
+			break;
+		}
+		result.coefficients.assign(b.begin(), b.begin() + degree + 1);
+		result.iterations = it + 1;
+		const long double levelled = std::fabs(b[degree + 1]);
+
+		// one extremum per run of samples with the same error sign
+		long double worst = 0;
+		extrema.clear();
+		std::size_t best = 0;
+		for (std::size_t i = 0; i < samples; ++i) {
+			err[i] = poly_value(result.coefficients, grid[i]) - target[i];
+			worst = std::max(worst, std::fabs(err[i]));
+			if (i > 0 && (err[i] < 0) != (err[best] < 0)) {
+				extrema.push_back(grid[best]);
+				best = i;
+			} else if (std::fabs(err[i]) > std::fabs(err[best])) {
+				best = i;
+			}
+		}
+		extrema.push_back(grid[best]);
+		result.max_error = worst;
+
+		if (worst <= levelled * (1 + tolerance) || extrema.size() < n) {
+			break;
+		}
+
+		// drop the smaller end extremum until the alternation has n points
+		while (extrema.size() > n) {
+			const long double first = std::fabs(poly_value(result.coefficients, extrema.front()) - f(extrema.front()));
+			const long double last = std::fabs(poly_value(result.coefficients, extrema.back()) - f(extrema.back()));
+			if (first < last) {
+				extrema.erase(extrema.begin());
+			} else {
+				extrema.pop_back();
+			}
+		}
+		ref = extrema;
+	}
+	return result;
+}
+
+/// Largest absolute error of the polynomial p against f over samples points of [lo, hi]
+/** p is evaluated by Horner in fixed-point on inputs of type X, the grid
+ *  points being truncated to X, and f on the same truncated inputs. */
+template <typename X, typename P, typename F>
+long double max_error(const P& p, F f, long double lo, long double hi, std::size_t samples = 4096)
+{
+	long double result = 0;
+	for (std::size_t i = 0; i < samples; ++i) {
+		const X x(lo + (hi - lo) * i / (samples > 1 ? samples - 1 : 1));
+		const long double err = std::fabs(p(x).getValueFLD() - f(x.getValueFLD()));
+		result = std::max(result, err);
+	}
+	return result;
+}
+
+/// Minimax fit of f over [lo, hi] quantised to the coefficient formats of P
+/** The degree is the one of P; each coefficient is rounded to nearest. */
+template <typename P, typename F>
+P minimax_poly(F f, long double lo, long double hi, minimax_result* fit = nullptr)
+{
+	const minimax_result result = minimax_fit(f, P::degree, lo, hi);
+	if (fit != nullptr) {
+		*fit = result;
+	}
+	return P(result.coefficients);
+}
+
+} // namespace fxp
+
+#endif /* end of include guard: FIXED_POINT_POLY_HPP */
@@ -0,0 +1,498 @@
+/** Copyright 2026 Politecnico di Milano
+ * Developed by: Stefano Cherubin
+ * PhD student, Politecnico di Milano
+ * <first_name>.<family_name>@polimi.it
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIXED_POINT_RANDOM_HPP
+#define FIXED_POINT_RANDOM_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "fixed_point_parallel.hpp"
+#include "fixed_point_traits.hpp"
+
+namespace fxp {
+
+// Random fixed-point values made straight from random bits, without going
+// through floating point: uniform values are the top bits of a random word
+// placed in raw_t, Gaussian values come from an integer ziggurat.
+//
+// Generators fill arrays of 64-bit words with generate(words, n); they work
+// on several independent blocks at once, in loops written for the
+// vectoriser, and the words left over from the last block are discarded.
+// Every stream is reproducible: philox4x32 is counter based, so a stream is
+// a seed and a stream number, and xoshiro256pp streams are 2^192 steps apart.
+
+//-----------------------------------------------------------------------------
+// GENERATORS
+//-----------------------------------------------------------------------------
+
+/// Philox4x32-10 counter-based generator (Salmon et al., 2011)
+/** Block b of a stream is the encryption of the counter (b, substream,
+ *  stream) under the 64-bit seed and gives two words; seek() and
+ *  substream() jump anywhere in constant time. */
+class philox4x32
+{
+public:
+	/// Blocks encrypted together by generate()
+	static const std::size_t lanes = 16;
+
+	explicit philox4x32(uint64_t seed = 0, uint32_t stream = 0)
+		: key0(static_cast<uint32_t>(seed)), key1(static_cast<uint32_t>(seed >> 32)),
+		  block(0), sub(0), stream(stream) {}
+
+	/// Next block to be generated
+	uint64_t position() const { return block; }
+
+	/// Continue from block b
+	void seek(uint64_t b) { block = b; }
+
+	/// Independent stream of the same seed and stream number, at block 0
+	philox4x32 substream(uint32_t s) const {
+		philox4x32 result(*this);
+		result.sub = s;
+		result.block = 0;
+		return result;
+	}
+
+	/// Fill words[0, n) with the next (n + 1) / 2 blocks
+	void generate(uint64_t* words, std::size_t n) {
+		uint32_t k0[10], k1[10];
+		k0[0] = key0;
+		k1[0] = key1;
+		for (int round = 1; round < 10; ++round) {
+			k0[round] = k0[round - 1] + 0x9E3779B9u;
+			k1[round] = k1[round - 1] + 0xBB67AE85u;
+		}
+		uint64_t low[lanes], high[lanes];
+		while (n > 0) {
+			const std::size_t blocks = (n + 1) / 2 < lanes ? (n + 1) / 2 : lanes;
+			// rounds unrolled within each block, blocks side by side in vector lanes
+			for (std::size_t l = 0; l < lanes; ++l) {
+				uint32_t x0 = static_cast<uint32_t>(block + l), x1 = static_cast<uint32_t>((block + l) >> 32);
+				uint32_t x2 = sub, x3 = stream;
+				for (int round = 0; round < 10; ++round) {
+					const uint64_t p0 = static_cast<uint64_t>(0xD2511F53u) * x0;
+					const uint64_t p1 = static_cast<uint64_t>(0xCD9E8D57u) * x2;
+					x0 = static_cast<uint32_t>(p1 >> 32) ^ x1 ^ k0[round];
+					x2 = static_cast<uint32_t>(p0 >> 32) ^ x3 ^ k1[round];
+					x1 = static_cast<uint32_t>(p1);
+					x3 = static_cast<uint32_t>(p0);
+				}
+				low[l] = static_cast<uint64_t>(x1) << 32 | x0;
+				high[l] = static_cast<uint64_t>(x3) << 32 | x2;
+			}
+			for (std::size_t l = 0; l < blocks; ++l) {
+				words[2 * l] = low[l];
+				if (2 * l + 1 < n) {
+					words[2 * l + 1] = high[l];
+				}
+			}
+			const std::size_t done = 2 * blocks < n ? 2 * blocks : n;
+			block += blocks;
+			words += done;
+			n -= done;
+		}
+	}
+
+	/// One Philox4x32-10 block of the given counter, four 32-bit words
+	void encrypt(const uint32_t counter[4], uint32_t out[4]) const {
+		uint32_t x0 = counter[0], x1 = counter[1], x2 = counter[2], x3 = counter[3];
+		uint32_t k0 = key0, k1 = key1;
+		for (int round = 0; round < 10; ++round) {
+			const uint64_t p0 = static_cast<uint64_t>(0xD2511F53u) * x0;
+			const uint64_t p1 = static_cast<uint64_t>(0xCD9E8D57u) * x2;
+			x0 = static_cast<uint32_t>(p1 >> 32) ^ x1 ^ k0;
+			x2 = static_cast<uint32_t>(p0 >> 32) ^ x3 ^ k1;
+			x1 = static_cast<uint32_t>(p1);
+			x3 = static_cast<uint32_t>(p0);
+			k0 += 0x9E3779B9u;
+			k1 += 0xBB67AE85u;
+		}
+		out[0] = x0;
+		out[1] = x1;
+		out[2] = x2;
+		out[3] = x3;
+	}
+
+private:
+	uint32_t key0, key1;
+	uint64_t block;
+	uint32_t sub, stream;
+};
+
+/// LANES interleaved xoshiro256++ generators (Blackman and Vigna, 2018)
+/** Lane l starts 2^128 * l steps after the state seeded by splitmix64, and
+ *  stream s is moved 2^192 * s steps further, so streams and lanes never
+ *  overlap in practice. Each generate() step gives one word per lane. */
+template <std::size_t LANES = 8>
+class xoshiro256pp
+{
+public:
+	static const std::size_t lanes = LANES;
+
+	explicit xoshiro256pp(uint64_t seed = 0, uint32_t stream = 0) {
+		uint64_t state[4];
+		for (int k = 0; k < 4; ++k) {
+			seed += 0x9E3779B97F4A7C15ull;
+			uint64_t z = seed;
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+			state[k] = z ^ (z >> 31);
+		}
+		static const uint64_t long_jump[4] = {
+			0x76E15D3EFEFDCBBFull, 0xC5004E441C522FB3ull, 0x77710069854EE241ull, 0x39109BB02ACBE635ull
+		};
+		static const uint64_t jump[4] = {
+			0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull, 0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull
+		};
+		for (uint32_t s = 0; s < stream; ++s) {
+			advance(state, long_jump);
+		}
+		for (std::size_t l = 0; l < LANES; ++l) {
+			for (int k = 0; k < 4; ++k) {
+				s_[k][l] = state[k];
+			}
+			advance(state, jump);
+		}
+	}
+
+	/// Fill words[0, n) with the next (n + LANES - 1) / LANES steps
+	void generate(uint64_t* words, std::size_t n) {
+		uint64_t* s0 = s_[0];
+		uint64_t* s1 = s_[1];
+		uint64_t* s2 = s_[2];
+		uint64_t* s3 = s_[3];
+		uint64_t step[LANES];
+		while (n > 0) {
+			for (std::size_t l = 0; l < LANES; ++l) {
+				const uint64_t sum = s0[l] + s3[l];
+				step[l] = ((sum << 23) | (sum >> 41)) + s0[l];
+				const uint64_t t = s1[l] << 17;
+				s2[l] ^= s0[l];
+				s3[l] ^= s1[l];
+				s1[l] ^= s2[l];
+				s0[l] ^= s3[l];
+				s2[l] ^= t;
+				s3[l] = (s3[l] << 45) | (s3[l] >> 19);
+			}
+			const std::size_t count = n < LANES ? n : LANES;
+			for (std::size_t l = 0; l < count; ++l) {
+				words[l] = step[l];
+			}
+			words += count;
+			n -= count;
+		}
+	}
+
+private:
+	uint64_t s_[4][LANES];
+
+	/// One xoshiro256 step of a single state
+	static void next(uint64_t s[4]) {
+		const uint64_t t = s[1] << 17;
+		s[2] ^= s[0];
+		s[3] ^= s[1];
+		s[1] ^= s[2];
+		s[0] ^= s[3];
+		s[2] ^= t;
+		s[3] = (s[3] << 45) | (s[3] >> 19);
+	}
+
+	/// Move s by the jump polynomial poly
+	static void advance(uint64_t s[4], const uint64_t poly[4]) {
+		uint64_t result[4] = {0, 0, 0, 0};
+		for (int w = 0; w < 4; ++w) {
+			for (int b = 0; b < 64; ++b) {
+				if (poly[w] & (uint64_t(1) << b)) {
+					for (int k = 0; k < 4; ++k) {
+						result[k] ^= s[k];
+					}
+				}
+				next(s);
+			}
+		}
+		for (int k = 0; k < 4; ++k) {
+			s[k] = result[k];
+		}
+	}
+};
+
+/// Run fn(generator, begin, end) over [0, n) in chunks of grain elements
+/** Chunk c gets g.substream(c), so the values do not depend on the number
+ *  of threads. */
+template <typename Fn>
+void parallel_generate(const philox4x32& g, std::size_t n, Fn fn, std::size_t grain = default_grain)
+{
+	if (grain == 0) {
+		grain = 1;
+	}
+	parallel_for((n + grain - 1) / grain, [&](std::size_t begin, std::size_t end) {
+		for (std::size_t c = begin; c < end; ++c) {
+			philox4x32 stream = g.substream(static_cast<uint32_t>(c));
+			fn(stream, c * grain, (c + 1) * grain < n ? (c + 1) * grain : n);
+		}
+	}, 1);
+}
+
+//-----------------------------------------------------------------------------
+// UNIFORM VALUES
+//-----------------------------------------------------------------------------
+
+/// Words converted per batch by the fill functions
+static const std::size_t random_batch = 256;
+
+/// High 64 bits of a * b
+inline uint64_t mul_high(uint64_t a, uint64_t b)
+{
+	const uint64_t a0 = static_cast<uint32_t>(a), a1 = a >> 32;
+	const uint64_t b0 = static_cast<uint32_t>(b), b1 = b >> 32;
+	const uint64_t mid = a1 * b0 + ((a0 * b0) >> 32);
+	const uint64_t mid2 = a0 * b1 + static_cast<uint32_t>(mid);
+	return a1 * b1 + (mid >> 32) + (mid2 >> 32);
+}
+
+/// Value of T made of the high bit_width bits of word, any value of T equally likely
+template <typename T>
+T random_value(uint64_t word)
+{
+	typedef fixed_point_traits<T> traits;
+	static_assert(traits::bit_width <= 64, "random values have at most 64 bits");
+	static const int shift = 64 - traits::bit_width;
+	return T::createRaw(static_cast<typename traits::raw_t>(traits::is_signed
+		? static_cast<uint64_t>(static_cast<int64_t>(word) >> shift)
+		: word >> shift));
+}
+
+/// Value in [0, 1) made of the high fractional_length bits of word
+template <typename T>
+T random_unit(uint64_t word)
+{
+	typedef fixed_point_traits<T> traits;
+	static_assert(traits::fractional_length >= 1 && traits::fractional_length <= 63,
+		"unit values need between 1 and 63 fractional bits");
+	static_assert(!traits::is_signed || traits::integer_length >= 1, "unit values need one integer bit");
+	return T::createRaw(static_cast<typename traits::raw_t>(word >> (64 - traits::fractional_length)));
+}
+
+/// Fill out[0, n) with values of T, each one equally likely
+template <typename G, typename T>
+void uniform_fill(G& g, T* out, std::size_t n)
+{
+	uint64_t words[random_batch];
+	for (std::size_t i = 0; i < n; i += random_batch) {
+		const std::size_t count = n - i < random_batch ? n - i : random_batch;
+		g.generate(words, count);
+		_FIXED_POINT_IVDEP_
+		for (std::size_t k = 0; k < count; ++k) {
+			out[i + k] = random_value<T>(words[k]);
+		}
+	}
+}
+
+/// Fill out[0, n) with values in [0, 1), each multiple of the resolution equally likely
+template <typename G, typename T>
+void unit_fill(G& g, T* out, std::size_t n)
+{
+	uint64_t words[random_batch];
+	for (std::size_t i = 0; i < n; i += random_batch) {
+		const std::size_t count = n - i < random_batch ? n - i : random_batch;
+		g.generate(words, count);
+		_FIXED_POINT_IVDEP_
+		for (std::size_t k = 0; k < count; ++k) {
+			out[i + k] = random_unit<T>(words[k]);
+		}
+	}
+}
+
+/// Fill out[0, n) with values in [lo, hi], each one equally likely up to (hi - lo) / 2^64
+/** The raw value is lo plus the high part of word times the number of
+ *  values, so no value is rejected and batches keep their length. */
+template <typename G, typename T>
+void uniform_fill(G& g, T* out, std::size_t n, const T& lo, const T& hi)
+{
+	typedef fixed_point_traits<T> traits;
+	typedef typename traits::raw_t raw_t;
+	static_assert(traits::bit_width <= 64, "random values have at most 64 bits");
+	// zero when [lo, hi] is the whole of a 64-bit format
+	const uint64_t range = static_cast<uint64_t>(hi.getRaw()) - static_cast<uint64_t>(lo.getRaw()) + 1;
+	const uint64_t base = static_cast<uint64_t>(lo.getRaw());
+	uint64_t words[random_batch];
+	for (std::size_t i = 0; i < n; i += random_batch) {
+		const std::size_t count = n - i < random_batch ? n - i : random_batch;
+		g.generate(words, count);
+		if (range == 0) {
+			for (std::size_t k = 0; k < count; ++k) {
+				out[i + k] = T::createRaw(static_cast<raw_t>(words[k]));
+			}
+		} else if (range <= (uint64_t(1) << 32)) {
+			_FIXED_POINT_IVDEP_
+			for (std::size_t k = 0; k < count; ++k) {
+				// high 64 bits of the 96-bit words[k] * range
+				const uint64_t mid = (words[k] >> 32) * range + ((words[k] & 0xFFFFFFFFu) * range >> 32);
+				out[i + k] = T::createRaw(static_cast<raw_t>(base + (mid >> 32)));
+			}
+		} else {
+			_FIXED_POINT_IVDEP_
+			for (std::size_t k = 0; k < count; ++k) {
+				out[i + k] = T::createRaw(static_cast<raw_t>(base + mul_high(words[k], range)));
+			}
+		}
+	}
+}
+
+//-----------------------------------------------------------------------------
+// GAUSSIAN VALUES
+//-----------------------------------------------------------------------------
+
+/// Tables of the 128-layer ziggurat of the standard normal (Marsaglia and Tsang, 2000)
+/** For a 32-bit signed j and layer i, j is accepted when |j| < bound[i],
+ *  and the sample is then j * width[i] / 2^59, width[i] being the layer
+ *  edge with 28 fractional bits. edge[i] and density[i] serve the rare
+ *  rejections. */
+struct ziggurat_tables
+{
+	static const int layers = 128;
+	/// Start of the tail
+	static constexpr double tail = 3.442619855899;
+
+	int64_t bound[layers];
+	int64_t width[layers];
+	double edge[layers];
+	double density[layers];
+
+	static const ziggurat_tables& get() {
+		static const ziggurat_tables tables;
+		return tables;
+	}
+
+private:
+	ziggurat_tables() {
+		const double m1 = 2147483648.0;
+		const double area = 9.91256303526217e-3;
+		double d = tail, t = tail;
+		const double q = area / std::exp(-0.5 * d * d);
+		bound[0] = static_cast<int64_t>((d / q) * m1);
+		bound[1] = 0;
+		edge[0] = q;
+		edge[layers - 1] = d;
+		density[0] = 1.0;
+		density[layers - 1] = std::exp(-0.5 * d * d);
+		for (int i = layers - 2; i >= 1; --i) {
+			d = std::sqrt(-2.0 * std::log(area / d + std::exp(-0.5 * d * d)));
+			bound[i + 1] = static_cast<int64_t>((d / t) * m1);
+			t = d;
+			density[i] = std::exp(-0.5 * d * d);
+			edge[i] = d;
+		}
+		for (int i = 0; i < layers; ++i) {
+			width[i] = static_cast<int64_t>(std::ldexp(edge[i], 28) + 0.5);
+		}
+	}
+};
+
+/// Standard normal sample from a ziggurat rejection, in double precision
+/** Called for about one sample in a hundred, with the rejected j and
+ *  layer; further random words come from g. */
+template <typename G>
+double ziggurat_fallback(G& g, int64_t j, int layer)
+{
+	// 2^-53
+	static const double unit_scale = 1.0 / 9007199254740992.0;
+	const ziggurat_tables& z = ziggurat_tables::get();
+	uint64_t words[2];
+	for (;;) {
+		const double x = static_cast<double>(j) * z.edge[layer] / 2147483648.0;
+		if (layer == 0) {
+			// tail beyond z.tail
+			double tx, ty;
+			do {
+				g.generate(words, 2);
+				tx = -std::log((static_cast<double>(words[0] >> 11) + 0.5) * unit_scale) / ziggurat_tables::tail;
+				ty = -std::log((static_cast<double>(words[1] >> 11) + 0.5) * unit_scale);
+			} while (ty + ty < tx * tx);
+			return j > 0 ? ziggurat_tables::tail + tx : -ziggurat_tables::tail - tx;
+		}
+		g.generate(words, 2);
+		const double u = static_cast<double>(words[0] >> 11) * unit_scale;
+		if (z.density[layer] + u * (z.density[layer - 1] - z.density[layer]) < std::exp(-0.5 * x * x)) {
+			return x;
+		}
+		j = static_cast<int32_t>(words[1] >> 32);
+		layer = static_cast<int>(words[1] & (ziggurat_tables::layers - 1));
+		if ((j < 0 ? -j : j) < z.bound[layer]) {
+			return static_cast<double>(j) * z.edge[layer] / 2147483648.0;
+		}
+	}
+}
+
+/// Fill out[0, n) with standard normal samples, saturated to T
+/** Each word gives a 32-bit signed value from its high half and a layer
+ *  from its low bits; accepted values, about 99 in 100, are scaled by one
+ *  integer multiply in a vectorised loop and the others go through
+ *  ziggurat_fallback(). T has at most 59 fractional bits. */
+template <typename G, typename T>
+void gaussian_fill(G& g, T* out, std::size_t n)
+{
+	typedef fixed_point_traits<T> traits;
+	typedef typename traits::raw_t raw_t;
+	static_assert(traits::bit_width <= 64, "random values have at most 64 bits");
+	static_assert(traits::is_signed, "gaussian values are signed");
+	static_assert(traits::fractional_length <= 59, "gaussian values have at most 59 fractional bits");
+	static const int shift = 59 - traits::fractional_length;
+	const ziggurat_tables& z = ziggurat_tables::get();
+	const int64_t* bound = z.bound;
+	const int64_t* width = z.width;
+	const int64_t max = static_cast<int64_t>(traits::max_raw());
+	const int64_t min = static_cast<int64_t>(traits::min_raw());
+
+	uint64_t words[random_batch];
+	int64_t raw[random_batch];
+	unsigned char rejected[random_batch];
+	for (std::size_t i = 0; i < n; i += random_batch) {
+		const std::size_t count = n - i < random_batch ? n - i : random_batch;
+		g.generate(words, count);
+		_FIXED_POINT_IVDEP_
+		for (std::size_t k = 0; k < count; ++k) {
+			const int64_t j = static_cast<int32_t>(words[k] >> 32);
+			const std::size_t layer = static_cast<std::size_t>(words[k] & (ziggurat_tables::layers - 1));
+			const int64_t x = (j * width[layer]) >> shift;
+			rejected[k] = (j < 0 ? -j : j) >= bound[layer];
+			raw[k] = x < min ? min : x > max ? max : x;
+		}
+		for (std::size_t k = 0; k < count; ++k) {
+			if (rejected[k]) {
+				const double x = std::ldexp(ziggurat_fallback(g, static_cast<int32_t>(words[k] >> 32),
+					static_cast<int>(words[k] & (ziggurat_tables::layers - 1))), traits::fractional_length);
+				raw[k] = x <= static_cast<double>(min) ? min
+					: x >= static_cast<double>(max) ? max : static_cast<int64_t>(std::floor(x));
+			}
+			out[i + k] = T::createRaw(static_cast<raw_t>(raw[k]));
+		}
+	}
+}
+
+} // namespace fxp
+
+#endif /* end of include guard: FIXED_POINT_RANDOM_HPP */
@@ -0,0 +1,398 @@
+/** Copyright 2026 Politecnico di Milano
+ * Developed by: Stefano Cherubin
+ * PhD student, Politecnico di Milano
+ * <first_name>.<family_name>@polimi.it
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIXED_POINT_SHM_HPP
+#define FIXED_POINT_SHM_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "fixed_point_traits.hpp"
+
+namespace fxp {
+
+// Lock-free ring buffers of fixed-point values in a POSIX shared memory
+// segment, for processes exchanging samples without sockets or copies
+// through the kernel. The segment starts with a header recording the
+// element format, which attach() checks against the type of the reader,
+// and the indices, each on its own cache line; the values follow.
+//
+// Writers reserve a span of free slots, fill it in place and commit it;
+// readers reserve a span of committed values, use it in place and release
+// it. Spans are at most two pieces, the ring wrapping around once. With
+// several producers or consumers (mpmc) reservations are compare and swap
+// loops and commits complete in reservation order.
+
+//-----------------------------------------------------------------------------
+// SEGMENT LAYOUT
+//-----------------------------------------------------------------------------
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "shared rings need lock-free 64-bit atomics");
+
+/// Producers and consumers sharing a ring
+enum ring_kind
+{
+	spsc = 1, ///< one producer, one consumer
+	mpmc = 2  ///< any number of producers and consumers
+};
+
+/// Header at the start of a ring segment
+struct ring_header
+{
+	static const uint32_t current_version = 1;
+
+	char magic[8];
+	uint32_t version;
+	uint32_t kind;
+	uint8_t is_signed;
+	uint8_t reserved;
+	uint16_t integer_length;
+	uint16_t fractional_length;
+	uint16_t element_size;
+	uint64_t capacity;
+	/// Offset of the values from the start of the segment
+	uint64_t data_offset;
+	/// Set last by the creator, once the header is complete
+	std::atomic<uint32_t> ready;
+
+	/// Values committed by the producers
+	alignas(cache_line_size) std::atomic<uint64_t> head;
+	/// Values reserved by the producers, head or more
+	alignas(cache_line_size) std::atomic<uint64_t> write_reserve;
+	/// Values released by the consumers
+	alignas(cache_line_size) std::atomic<uint64_t> tail;
+	/// Values reserved by the consumers, tail or more
+	alignas(cache_line_size) std::atomic<uint64_t> read_reserve;
+};
+
+/// Up to two runs of slots of a ring, and the indices they stand for
+template <typename T>
+struct ring_span
+{
+	T* first;
+	std::size_t first_size;
+	T* second;
+	std::size_t second_size;
+	/// Index of the first slot since the creation of the ring
+	uint64_t start;
+
+	std::size_t size() const { return first_size + second_size; }
+	bool empty() const { return size() == 0; }
+
+	T& operator[](std::size_t i) const { return i < first_size ? first[i] : second[i - first_size]; }
+};
+
+//-----------------------------------------------------------------------------
+// SHARED RING
+//-----------------------------------------------------------------------------
+
+/// Ring of capacity values of T in the shared memory segment name
+/** Obtained with create() or attach(); an object that is not valid() holds
+ *  no segment. Objects are movable, not copyable; the segment lives until
+ *  remove() and the last unmapping. */
+template <typename T, ring_kind KIND = spsc>
+class shared_ring
+{
+public:
+	typedef fixed_point_traits<T> traits;
+
+	shared_ring() : header_(nullptr), data_(nullptr), size_(0), mask_(0), cached_tail_(0), cached_head_(0) {}
+
+	shared_ring(shared_ring&& other)
+		: header_(other.header_), data_(other.data_), size_(other.size_), mask_(other.mask_),
+		  cached_tail_(other.cached_tail_), cached_head_(other.cached_head_) {
+		other.header_ = nullptr;
+		other.data_ = nullptr;
+		other.size_ = 0;
+	}
+
+	shared_ring& operator=(shared_ring&& other) {
+		if (this != &other) {
+			unmap();
+			header_ = other.header_;
+			data_ = other.data_;
+			size_ = other.size_;
+			mask_ = other.mask_;
+			cached_tail_ = other.cached_tail_;
+			cached_head_ = other.cached_head_;
+			other.header_ = nullptr;
+			other.data_ = nullptr;
+			other.size_ = 0;
+		}
+		return *this;
+	}
+
+	shared_ring(const shared_ring&) = delete;
+	shared_ring& operator=(const shared_ring&) = delete;
+
+	~shared_ring() {
+		unmap();
+	}
+
+	/// Create the segment name, e.g. "/samples", for capacity values rounded up to a power of two
+	/** Fails, giving a ring that is not valid(), when the segment exists. */
+	static shared_ring create(const char* name, std::size_t capacity) {
+		shared_ring ring;
+		uint64_t slots = 1;
+		while (slots < capacity) {
+			slots <<= 1;
+		}
+		const std::size_t data_offset = (sizeof(ring_header) + cache_line_size - 1) / cache_line_size * cache_line_size;
+		const std::size_t size = data_offset + static_cast<std::size_t>(slots) * sizeof(T);
+		const int fd = ::shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+		if (fd < 0) {
+			return ring;
+		}
+		void* address = ::ftruncate(fd, static_cast<off_t>(size)) == 0
+			? ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED;
+		::close(fd);
+		if (address == MAP_FAILED) {
+			::shm_unlink(name);
+			return ring;
+		}
+		ring_header* header = new (address) ring_header();
+		std::memcpy(header->magic, "FXPRING", 8);
+		header->version = ring_header::current_version;
+		header->kind = KIND;
+		header->is_signed = traits::is_signed ? 1 : 0;
+		header->reserved = 0;
+		header->integer_length = traits::integer_length;
+		header->fractional_length = traits::fractional_length;
+		header->element_size = sizeof(T);
+		header->capacity = slots;
+		header->data_offset = data_offset;
+		header->head.store(0, std::memory_order_relaxed);
+		header->write_reserve.store(0, std::memory_order_relaxed);
+		header->tail.store(0, std::memory_order_relaxed);
+		header->read_reserve.store(0, std::memory_order_relaxed);
+		header->ready.store(1, std::memory_order_release);
+		ring.map(address, size);
+		return ring;
+	}
+
+	/// Attach to the segment name
+	/** The ring is not valid() when the segment does not exist, is not
+	 *  ready yet, or holds another kind of ring or values of another
+	 *  format than T. */
+	static shared_ring attach(const char* name) {
+		shared_ring ring;
+		const int fd = ::shm_open(name, O_RDWR, 0600);
+		if (fd < 0) {
+			return ring;
+		}
+		struct stat st;
+		void* address = MAP_FAILED;
+		std::size_t size = 0;
+		if (::fstat(fd, &st) == 0 && static_cast<std::size_t>(st.st_size) >= sizeof(ring_header)) {
+			size = static_cast<std::size_t>(st.st_size);
+			address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		}
+		::close(fd);
+		if (address == MAP_FAILED) {
+			return ring;
+		}
+		const ring_header* header = static_cast<const ring_header*>(address);
+		const bool compatible = header->ready.load(std::memory_order_acquire) == 1
+			&& std::memcmp(header->magic, "FXPRING", 8) == 0
+			&& header->version == ring_header::current_version
+			&& header->kind == static_cast<uint32_t>(KIND)
+			&& header->is_signed == (traits::is_signed ? 1 : 0)
+			&& header->integer_length == traits::integer_length
+			&& header->fractional_length == traits::fractional_length
+			&& header->element_size == sizeof(T)
+			&& header->capacity != 0 && (header->capacity & (header->capacity - 1)) == 0
+			&& header->data_offset >= sizeof(ring_header)
+			&& header->data_offset + header->capacity * sizeof(T) <= size;
+		if (!compatible) {
+			::munmap(address, size);
+			return ring;
+		}
+		ring.map(address, size);
+		return ring;
+	}
+
+	/// Remove the segment name; mapped rings keep working
+	static bool remove(const char* name) {
+		return ::shm_unlink(name) == 0;
+	}
+
+	bool valid() const { return header_ != nullptr; }
+	std::size_t capacity() const { return static_cast<std::size_t>(mask_ + 1); }
+
+	/// Committed values not yet released, a snapshot
+	std::size_t size() const {
+		return static_cast<std::size_t>(header_->head.load(std::memory_order_acquire)
+			- header_->tail.load(std::memory_order_acquire));
+	}
+
+	//-------------------------------------------------------------------------
+	// PRODUCER
+	//-------------------------------------------------------------------------
+
+	/// Reserve up to n free slots to be filled in place
+	/** Returns an empty span when the ring is full. */
+	ring_span<T> begin_write(std::size_t n) {
+		uint64_t start = header_->write_reserve.load(std::memory_order_relaxed);
+		uint64_t count;
+		if (KIND == spsc) {
+			// the tail is read again only when the cached one shows too little room
+			count = free_slots(start, cached_tail_, n);
+			if (count < n) {
+				cached_tail_ = header_->tail.load(std::memory_order_acquire);
+				count = free_slots(start, cached_tail_, n);
+			}
+			header_->write_reserve.store(start + count, std::memory_order_relaxed);
+		} else {
+			do {
+				count = free_slots(start, header_->tail.load(std::memory_order_acquire), n);
+			} while (count > 0 && !header_->write_reserve.compare_exchange_weak(start, start + count,
+				std::memory_order_acq_rel, std::memory_order_relaxed));
+		}
+		return span(start, static_cast<std::size_t>(count));
+	}
+
+	/// Publish a span of begin_write(), once filled
+	/** With mpmc, waits for the spans reserved before it to be committed. */
+	void commit_write(const ring_span<T>& s) {
+		if (s.empty()) {
+			return;
+		}
+		if (KIND == mpmc) {
+			while (header_->head.load(std::memory_order_acquire) != s.start) {
+				std::this_thread::yield();
+			}
+		}
+		header_->head.store(s.start + s.size(), std::memory_order_release);
+	}
+
+	/// Copy up to n values into the ring, returning the number written
+	std::size_t write(const T* values, std::size_t n) {
+		const ring_span<T> s = begin_write(n);
+		std::memcpy(static_cast<void*>(s.first), values, s.first_size * sizeof(T));
+		std::memcpy(static_cast<void*>(s.second), values + s.first_size, s.second_size * sizeof(T));
+		commit_write(s);
+		return s.size();
+	}
+
+	//-------------------------------------------------------------------------
+	// CONSUMER
+	//-------------------------------------------------------------------------
+
+	/// Reserve up to n committed values to be read in place
+	/** Returns an empty span when the ring is empty. */
+	ring_span<T> begin_read(std::size_t n) {
+		uint64_t start = header_->read_reserve.load(std::memory_order_relaxed);
+		uint64_t count;
+		if (KIND == spsc) {
+			// the head is read again only when the cached one shows too few values
+			count = cached_head_ - start < n ? cached_head_ - start : n;
+			if (count < n) {
+				cached_head_ = header_->head.load(std::memory_order_acquire);
+				count = cached_head_ - start < n ? cached_head_ - start : n;
+			}
+			header_->read_reserve.store(start + count, std::memory_order_relaxed);
+		} else {
+			do {
+				const uint64_t available = header_->head.load(std::memory_order_acquire) - start;
+				count = available < n ? available : n;
+			} while (count > 0 && !header_->read_reserve.compare_exchange_weak(start, start + count,
+				std::memory_order_acq_rel, std::memory_order_relaxed));
+		}
+		return span(start, static_cast<std::size_t>(count));
+	}
+
+	/// Release a span of begin_read(), once used, to the producers
+	/** With mpmc, waits for the spans reserved before it to be released. */
+	void commit_read(const ring_span<T>& s) {
+		if (s.empty()) {
+			return;
+		}
+		if (KIND == mpmc) {
+			while (header_->tail.load(std::memory_order_acquire) != s.start) {
+				std::this_thread::yield();
+			}
+		}
+		header_->tail.store(s.start + s.size(), std::memory_order_release);
+	}
+
+	/// Copy up to n values out of the ring, returning the number read
+	std::size_t read(T* values, std::size_t n) {
+		const ring_span<T> s = begin_read(n);
+		std::memcpy(static_cast<void*>(values), s.first, s.first_size * sizeof(T));
+		std::memcpy(static_cast<void*>(values + s.first_size), s.second, s.second_size * sizeof(T));
+		commit_read(s);
+		return s.size();
+	}
+
+private:
+	ring_header* header_;
+	T* data_;
+	std::size_t size_;
+	uint64_t mask_;
+	/// spsc only: last tail seen by the producer and head seen by the consumer
+	uint64_t cached_tail_;
+	uint64_t cached_head_;
+
+	void map(void* address, std::size_t size) {
+		header_ = static_cast<ring_header*>(address);
+		data_ = reinterpret_cast<T*>(static_cast<char*>(address) + header_->data_offset);
+		size_ = size;
+		mask_ = header_->capacity - 1;
+		cached_tail_ = header_->tail.load(std::memory_order_acquire);
+		cached_head_ = header_->head.load(std::memory_order_acquire);
+	}
+
+	void unmap() {
+		if (header_ != nullptr) {
+			::munmap(header_, size_);
+			header_ = nullptr;
+		}
+	}
+
+	/// Free slots from start, at most n, the consumers having released up to tail
+	uint64_t free_slots(uint64_t start, uint64_t tail, std::size_t n) const {
+		const uint64_t free = mask_ + 1 - (start - tail);
+		return free < n ? free : n;
+	}
+
+	ring_span<T> span(uint64_t start, std::size_t count) const {
+		const std::size_t at = static_cast<std::size_t>(start & mask_);
+		const std::size_t run = count < capacity() - at ? count : capacity() - at;
+		ring_span<T> s = {data_ + at, run, data_, count - run, start};
+		return s;
+	}
+};
+
+} // namespace fxp
+
+#endif /* end of include guard: FIXED_POINT_SHM_HPP */
@@ -0,0 +1,326 @@
+/** Copyright 2026 Politecnico di Milano
+ * Developed by: Stefano Cherubin
+ * PhD student, Politecnico di Milano
+ * <first_name>.<family_name>@polimi.it
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIXED_POINT_SOA_HPP
+#define FIXED_POINT_SOA_HPP
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if __cplusplus >= 202002L
+#include <span>
+#endif
+
+#include "fixed_point_buffer.hpp"
+#include "fixed_point_traits.hpp"
+
+namespace fxp {
+
+// Structure of arrays: records of fixed-point fields kept as one aligned
+// column per field, so that a kernel over a field streams over values of
+// a single width, and fields of different widths are never interleaved
+// in the same vector.
+//
+// Example: soa< fixed_point_t<8,8>, fixed_point_t<8,8>, ufixed_point_t<4,12> >
+// holds records {x, y, w}; column<0>() is every x, contiguous.
+
+template <typename S>
+class soa_row;
+
+//-----------------------------------------------------------------------------
+// CONTAINER
+//-----------------------------------------------------------------------------
+
+/// Records of Fields, each field stored in its own column
+template <typename... Fields>
+class soa
+{
+	static_assert(sizeof...(Fields) > 0, "a record needs at least one field");
+
+public:
+	/// Number of fields
+	static const std::size_t fields = sizeof...(Fields);
+
+	/// Format of the field K
+	template <std::size_t K>
+	struct field { typedef typename std::tuple_element<K, std::tuple<Fields...> >::type RESULT; };
+
+	/// Record copied out of the container
+	typedef std::tuple<Fields...> value_type;
+	typedef soa_row<soa> reference;
+	typedef soa_row<const soa> const_reference;
+
+	soa() : size_(0) {}
+
+	/// n records of zeros, backed by huge pages if hugepages
+	explicit soa(std::size_t n, bool hugepages = false)
+		: columns_(buffer<Fields>(n, hugepages)...), size_(n) {}
+
+	std::size_t size() const { return size_; }
+	bool empty() const { return size_ == 0; }
+	/// size() rounded up to the whole vectors of the widest field
+	std::size_t padded_size() const { return padded_count(size_, max_field_size<Fields...>::value, simd_alignment); }
+
+	/// Resize every column to n records, zeroing the new ones
+	void resize(std::size_t n) {
+		each_column<0>(column_resize(n), std::integral_constant<bool, fields == 0>());
+		size_ = n;
+	}
+
+	/// Allocate room for n records in every column
+	void reserve(std::size_t n) {
+		each_column<0>(column_reserve(n), std::integral_constant<bool, fields == 0>());
+	}
+
+	void clear() { resize(0); }
+
+	/// Append a record, growing the columns geometrically
+	void push_back(const Fields&... values) {
+		grow(size_ + 1);
+		(*this)[size_ - 1].assign(values...);
+	}
+
+	void push_back(const value_type& record) {
+		grow(size_ + 1);
+		(*this)[size_ - 1] = record;
+	}
+
+	void pop_back() { resize(size_ - 1); }
+
+	/// Exchange the records i and j
+	void swap_rows(std::size_t i, std::size_t j) {
+		each_column<0>(column_swap(i, j), std::integral_constant<bool, fields == 0>());
+	}
+
+	void swap(soa& other) {
+		columns_.swap(other.columns_);
+		std::swap(size_, other.size_);
+	}
+
+	//-------------------------------------------------------------------------
+	// ROWS
+
+	reference operator[](std::size_t i) { return reference(this, i); }
+	const_reference operator[](std::size_t i) const { return const_reference(this, i); }
+
+	//-------------------------------------------------------------------------
+	// COLUMNS
+
+	/// Values of the field K, aligned to simd_alignment, padded with zeros
+	template <std::size_t K>
+	typename field<K>::RESULT* column() { return std::get<K>(columns_).data(); }
+
+	template <std::size_t K>
+	const typename field<K>::RESULT* column() const { return std::get<K>(columns_).data(); }
+
+	/// Raw values of the field K
+	template <std::size_t K>
+	typename fixed_point_traits<typename field<K>::RESULT>::raw_t* raw_column() { return raw_data(column<K>()); }
+
+	template <std::size_t K>
+	const typename fixed_point_traits<typename field<K>::RESULT>::raw_t* raw_column() const { return raw_data(column<K>()); }
+
+	/// One dimensional view of the field K
+	template <std::size_t K>
+	tensor_view<typename field<K>::RESULT, 1> view() {
+		return tensor_view<typename field<K>::RESULT, 1>(column<K>(), &size_);
+	}
+
+	template <std::size_t K>
+	tensor_view<const typename field<K>::RESULT, 1> view() const {
+		return tensor_view<const typename field<K>::RESULT, 1>(column<K>(), &size_);
+	}
+
+#if __cplusplus >= 202002L
+	template <std::size_t K>
+	std::span<typename field<K>::RESULT> span() { return std::span<typename field<K>::RESULT>(column<K>(), size_); }
+
+	template <std::size_t K>
+	std::span<const typename field<K>::RESULT> span() const { return std::span<const typename field<K>::RESULT>(column<K>(), size_); }
+#endif
+
+private:
+	template <typename... Types>
+	struct max_field_size;
+
+	template <typename T>
+	struct max_field_size<T> : std::integral_constant<std::size_t, sizeof(T)> {};
+
+	template <typename T, typename... Types>
+	struct max_field_size<T, Types...>
+		: std::integral_constant<std::size_t, (sizeof(T) > max_field_size<Types...>::value ?
+			sizeof(T) : max_field_size<Types...>::value)> {};
+
+	struct column_resize
+	{
+		std::size_t n;
+		explicit column_resize(std::size_t n) : n(n) {}
+		template <typename B>
+		void operator()(B& column) const { column.resize(n); }
+	};
+
+	struct column_reserve
+	{
+		std::size_t n;
+		explicit column_reserve(std::size_t n) : n(n) {}
+		template <typename B>
+		void operator()(B& column) const { column.reserve(n); }
+	};
+
+	struct column_swap
+	{
+		std::size_t i, j;
+		column_swap(std::size_t i, std::size_t j) : i(i), j(j) {}
+		template <typename B>
+		void operator()(B& column) const { std::swap(column[i], column[j]); }
+	};
+
+	template <std::size_t K, typename F>
+	void each_column(const F&, std::true_type) {}
+
+	template <std::size_t K, typename F>
+	void each_column(const F& f, std::false_type) {
+		f(std::get<K>(columns_));
+		each_column<K + 1>(f, std::integral_constant<bool, K + 1 == fields>());
+	}
+
+	void grow(std::size_t n) {
+		if (n > std::get<0>(columns_).capacity()) {
+			reserve(n < 16 ? 16 : 2 * n);
+		}
+		resize(n);
+	}
+
+	std::tuple<buffer<Fields>...> columns_;
+	std::size_t size_;
+};
+
+//-----------------------------------------------------------------------------
+// ROW REFERENCES
+//-----------------------------------------------------------------------------
+
+/// Reference to the record of index i of the container S, soa or const soa
+/** Assigning to a row writes the fields through to the columns; copying the
+ *  row object itself does not copy the record, use value() for that. */
+template <typename S>
+class soa_row
+{
+	typedef typename std::remove_const<S>::type container_t;
+
+public:
+	typedef typename container_t::value_type value_type;
+	static const std::size_t fields = container_t::fields;
+
+	soa_row(S* owner, std::size_t index) : owner_(owner), index_(index) {}
+	soa_row(const soa_row&) = default;
+
+	/// Row of a non-const container, seen as read-only
+	template <typename U>
+	soa_row(const soa_row<U>& other,
+		typename std::enable_if<std::is_convertible<U*, S*>::value>::type* = nullptr)
+		: owner_(other.owner()), index_(other.index()) {}
+
+	/// Field K of the record
+	template <std::size_t K>
+	auto get() const -> decltype(std::declval<S&>().template column<K>()[0]) {
+		return owner_->template column<K>()[index_];
+	}
+
+	/// Copy of the record
+	value_type value() const {
+		value_type result;
+		load<0>(result, std::integral_constant<bool, fields == 0>());
+		return result;
+	}
+
+	operator value_type() const { return value(); }
+
+	const soa_row& operator=(const value_type& record) const {
+		store<0>(record, std::integral_constant<bool, fields == 0>());
+		return *this;
+	}
+
+	/// Copy the record of other, which may belong to another container
+	const soa_row& operator=(const soa_row& other) const {
+		return *this = other.value();
+	}
+
+	template <typename U>
+	const soa_row& operator=(const soa_row<U>& other) const {
+		return *this = other.value();
+	}
+
+	/// Set every field at once
+	template <typename... Values>
+	void assign(const Values&... values) const {
+		*this = value_type(values...);
+	}
+
+	S* owner() const { return owner_; }
+	std::size_t index() const { return index_; }
+
+private:
+	template <std::size_t K>
+	void load(value_type&, std::true_type) const {}
+
+	template <std::size_t K>
+	void load(value_type& record, std::false_type) const {
+		std::get<K>(record) = get<K>();
+		load<K + 1>(record, std::integral_constant<bool, K + 1 == fields>());
+	}
+
+	template <std::size_t K>
+	void store(const value_type&, std::true_type) const {}
+
+	template <std::size_t K>
+	void store(const value_type& record, std::false_type) const {
+		get<K>() = std::get<K>(record);
+		store<K + 1>(record, std::integral_constant<bool, K + 1 == fields>());
+	}
+
+	S* owner_;
+	std::size_t index_;
+};
+
+/// Field K of a row, as std::get does for tuples
+template <std::size_t K, typename S>
+auto get(const soa_row<S>& row) -> decltype(row.template get<K>())
+{
+	return row.template get<K>();
+}
+
+/// Exchange two records through their references
+template <typename S>
+void swap(const soa_row<S>& a, const soa_row<S>& b)
+{
+	const typename soa_row<S>::value_type tmp = a.value();
+	a = b;
+	b = tmp;
+}
+
+} // namespace fxp
+
+#endif /* end of include guard: FIXED_POINT_SOA_HPP */
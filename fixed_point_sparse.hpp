@@ -0,0 +1,330 @@
+/** Copyright 2026 Politecnico di Milano
+ * Developed by: Stefano Cherubin
+ * PhD student, Politecnico di Milano
+ * <first_name>.<family_name>@polimi.it
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIXED_POINT_SPARSE_HPP
+#define FIXED_POINT_SPARSE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "fixed_point_parallel.hpp"
+#include "fixed_point_traits.hpp"
+
+namespace fxp {
+
+//-----------------------------------------------------------------------------
+// ACCUMULATION
+//-----------------------------------------------------------------------------
+
+/// Integer accumulating the products of a row, see product_accumulator
+/** A row is truncated to the output format once, at the end. */
+template <typename T, typename X>
+struct sparse_accumulator : product_accumulator<T, X> {};
+
+//-----------------------------------------------------------------------------
+// COMPRESSED SPARSE ROWS
+//-----------------------------------------------------------------------------
+
+/// Sparse matrix in compressed sparse row (CSR) format
+/** The non-zeros of row i are values[k] at column col_index[k] for k in
+ *  [row_ptr[i], row_ptr[i + 1]). */
+template <typename T, typename index_t = uint32_t>
+struct csr_matrix
+{
+	static_assert(fixed_point_traits<T>::is_fixed_point, "csr_matrix holds fixed-point values");
+
+	typedef T value_t;
+
+	std::size_t rows;
+	std::size_t cols;
+	std::vector<std::size_t> row_ptr;
+	std::vector<index_t> col_index;
+	std::vector<T> values;
+
+	csr_matrix() : rows(0), cols(0), row_ptr(1, 0) {}
+
+	csr_matrix(std::size_t rows, std::size_t cols) : rows(rows), cols(cols), row_ptr(rows + 1, 0) {}
+
+	std::size_t nnz() const { return values.size(); }
+
+	/// Non-zeros of the dense row-major matrix a
+	static csr_matrix from_dense(const T* a, std::size_t rows, std::size_t cols, std::size_t lda) {
+		csr_matrix m(rows, cols);
+		for (std::size_t i = 0; i < rows; ++i) {
+			for (std::size_t j = 0; j < cols; ++j) {
+				if (a[i * lda + j].getRaw() != 0) {
+					m.col_index.push_back(static_cast<index_t>(j));
+					m.values.push_back(a[i * lda + j]);
+				}
+			}
+			m.row_ptr[i + 1] = m.values.size();
+		}
+		return m;
+	}
+
+	/// Matrix with the count entries (row[k], col[k], value[k]), duplicates summed
+	static csr_matrix from_triplets(std::size_t rows, std::size_t cols,
+		const std::size_t* row, const std::size_t* col, const T* value, std::size_t count)
+	{
+		std::vector<std::size_t> order(count);
+		for (std::size_t k = 0; k < count; ++k) {
+			order[k] = k;
+		}
+		std::stable_sort(order.begin(), order.end(), [=](std::size_t p, std::size_t q) {
+			return row[p] != row[q] ? row[p] < row[q] : col[p] < col[q];
+		});
+		csr_matrix m(rows, cols);
+		for (std::size_t k = 0; k < count; ++k) {
+			const std::size_t e = order[k];
+			if (k > 0 && row[e] == row[order[k - 1]] && col[e] == col[order[k - 1]]) {
+				m.values.back() += value[e];
+			} else {
+				m.col_index.push_back(static_cast<index_t>(col[e]));
+				m.values.push_back(value[e]);
+				++m.row_ptr[row[e] + 1];
+			}
+		}
+		for (std::size_t i = 0; i < rows; ++i) {
+			m.row_ptr[i + 1] += m.row_ptr[i];
+		}
+		return m;
+	}
+};
+
+/// First row of the given chunk, splitting the rows in chunks of about the same number of non-zeros
+/** The last chunk ends at a.rows, so trailing empty rows belong to it and
+ *  are written too. */
+template <typename T, typename index_t>
+std::size_t csr_chunk_begin(const csr_matrix<T, index_t>& a, std::size_t chunks, std::size_t chunk)
+{
+	if (chunk >= chunks) {
+		return a.rows;
+	}
+	const std::size_t target = chunk_begin(a.nnz(), chunks, chunk);
+	return static_cast<std::size_t>(
+		std::lower_bound(a.row_ptr.begin(), a.row_ptr.end() - 1, target) - a.row_ptr.begin());
+}
+
+/// y = A x, each row accumulated on sparse_accumulator<T, X> and truncated to Y once
+/** Rows are split among the threads by number of non-zeros.
+ *  \param grain Minimum number of non-zeros per thread */
+template <typename T, typename index_t, typename X, typename Y>
+void spmv(const csr_matrix<T, index_t>& a, const X* x, Y* y, std::size_t grain = default_grain)
+{
+	typedef sparse_accumulator<T, X> acc;
+	const std::size_t chunks = chunk_count(a.nnz(), grain);
+	parallel_chunks(a.nnz(), chunks, [&](std::size_t chunk, std::size_t, std::size_t) {
+		const std::size_t begin = csr_chunk_begin(a, chunks, chunk);
+		const std::size_t end = csr_chunk_begin(a, chunks, chunk + 1);
+		const std::size_t* row_ptr = a.row_ptr.data();
+		const index_t* col = a.col_index.data();
+		const T* val = a.values.data();
+		for (std::size_t i = begin; i < end; ++i) {
+			typename acc::acc_t sum = 0;
+			for (std::size_t k = row_ptr[i]; k < row_ptr[i + 1]; ++k) {
+				sum += acc::product_of(val[k], x[col[k]]);
+			}
+			y[i] = acc::template narrow<Y>(sum);
+		}
+	});
+}
+
+/// Y = A X for a dense X of cols x k with leading dimension ldx, Y of rows x k with leading dimension ldy
+/** Each row of Y is accumulated on k wide sums, the inner loop running
+ *  along the rows of X so that it vectorises, and truncated once. */
+template <typename T, typename index_t, typename X, typename Y>
+void spmm(const csr_matrix<T, index_t>& a, const X* x, std::size_t k, std::size_t ldx,
+	Y* y, std::size_t ldy, std::size_t grain = default_grain)
+{
+	typedef sparse_accumulator<T, X> acc;
+	typedef typename acc::acc_t acc_t;
+	const std::size_t chunks = chunk_count(a.nnz() * k, grain);
+	parallel_chunks(a.nnz(), chunks, [&](std::size_t chunk, std::size_t, std::size_t) {
+		const std::size_t begin = csr_chunk_begin(a, chunks, chunk);
+		const std::size_t end = csr_chunk_begin(a, chunks, chunk + 1);
+		std::vector<acc_t> sums(k);
+		acc_t* sum = sums.data();
+		for (std::size_t i = begin; i < end; ++i) {
+			std::fill(sums.begin(), sums.end(), acc_t(0));
+			for (std::size_t p = a.row_ptr[i]; p < a.row_ptr[i + 1]; ++p) {
+				const T v = a.values[p];
+				const X* row = x + a.col_index[p] * ldx;
+				_FIXED_POINT_IVDEP_
+				for (std::size_t c = 0; c < k; ++c) {
+					sum[c] += acc::product_of(v, row[c]);
+				}
+			}
+			Y* out = y + i * ldy;
+			_FIXED_POINT_IVDEP_
+			for (std::size_t c = 0; c < k; ++c) {
+				out[c] = acc::template narrow<Y>(sum[c]);
+			}
+		}
+	});
+}
+
+//-----------------------------------------------------------------------------
+// SLICED ELLPACK
+//-----------------------------------------------------------------------------
+
+/// Sparse matrix in SELL-C-sigma format
+/** Rows are sorted by decreasing length within windows of sigma rows and
+ *  grouped in slices of C rows; a slice is stored column-major, padded to
+ *  its longest row with zeros, so that one step of the SpMV loop processes
+ *  the k-th non-zero of C consecutive rows and vectorises across rows.
+ *  Sorting within windows bounds the padding while keeping the accesses to
+ *  y local; sigma == 1 is plain sliced ELLPACK. Row slice_rows[r] of the
+ *  matrix is stored as row r. */
+template <typename T, std::size_t C = 8, typename index_t = uint32_t>
+struct sell_matrix
+{
+	static_assert(fixed_point_traits<T>::is_fixed_point, "sell_matrix holds fixed-point values");
+	static_assert(C > 0, "slices need at least one row");
+
+	typedef T value_t;
+	static const std::size_t chunk = C;
+
+	std::size_t rows;
+	std::size_t cols;
+	/// Original row of each stored row, padded to a multiple of C
+	std::vector<std::size_t> slice_rows;
+	/// Offset of the first element of each slice, one more for the end
+	std::vector<std::size_t> slice_ptr;
+	std::vector<index_t> col_index;
+	std::vector<T> values;
+
+	sell_matrix() : rows(0), cols(0), slice_ptr(1, 0) {}
+
+	std::size_t slices() const { return slice_ptr.size() - 1; }
+
+	/// Same matrix as the CSR a, rows sorted within windows of sigma rows
+	template <typename csr_index_t>
+	static sell_matrix from_csr(const csr_matrix<T, csr_index_t>& a, std::size_t sigma = 1) {
+		sell_matrix m;
+		m.rows = a.rows;
+		m.cols = a.cols;
+		if (sigma == 0) {
+			sigma = 1;
+		}
+		const std::size_t slices = (a.rows + C - 1) / C;
+		std::vector<std::size_t> order(a.rows);
+		for (std::size_t i = 0; i < a.rows; ++i) {
+			order[i] = i;
+		}
+		for (std::size_t w = 0; w < a.rows; w += sigma) {
+			const std::size_t we = w + sigma < a.rows ? w + sigma : a.rows;
+			std::stable_sort(order.begin() + w, order.begin() + we, [&](std::size_t p, std::size_t q) {
+				return a.row_ptr[p + 1] - a.row_ptr[p] > a.row_ptr[q + 1] - a.row_ptr[q];
+			});
+		}
+		m.slice_rows.assign(slices * C, a.rows);
+		std::copy(order.begin(), order.end(), m.slice_rows.begin());
+		m.slice_ptr.assign(slices + 1, 0);
+		for (std::size_t s = 0; s < slices; ++s) {
+			std::size_t length = 0;
+			for (std::size_t r = s * C; r < (s + 1) * C && r < a.rows; ++r) {
+				const std::size_t i = order[r];
+				length = std::max(length, a.row_ptr[i + 1] - a.row_ptr[i]);
+			}
+			m.slice_ptr[s + 1] = m.slice_ptr[s] + length * C;
+		}
+		m.col_index.assign(m.slice_ptr[slices], index_t(0));
+		m.values.assign(m.slice_ptr[slices], T::createRaw(0));
+		for (std::size_t s = 0; s < slices; ++s) {
+			for (std::size_t r = 0; r < C && s * C + r < a.rows; ++r) {
+				const std::size_t i = order[s * C + r];
+				for (std::size_t k = a.row_ptr[i]; k < a.row_ptr[i + 1]; ++k) {
+					const std::size_t e = m.slice_ptr[s] + (k - a.row_ptr[i]) * C + r;
+					m.col_index[e] = static_cast<index_t>(a.col_index[k]);
+					m.values[e] = a.values[k];
+				}
+			}
+		}
+		return m;
+	}
+};
+
+/// Raw values of x as read by the SELL-C-sigma SpMV
+/** The vectoriser gathers elements of 32 bits or more, narrower raw values
+ *  are widened once to 32 bits, other ones are read in place. */
+template <typename X, bool WIDEN = (sizeof(typename fixed_point_traits<X>::raw_t) < 4)>
+struct sell_gather
+{
+	typedef typename fixed_point_traits<X>::raw_t gather_t;
+
+	const gather_t* data;
+
+	sell_gather(const X* x, std::size_t) : data(raw_data(x)) {}
+};
+
+template <typename X>
+struct sell_gather<X, true>
+{
+	typedef typename std::conditional<fixed_point_traits<X>::is_signed, int32_t, uint32_t>::type gather_t;
+
+	std::vector<gather_t> widened;
+	const gather_t* data;
+
+	sell_gather(const X* x, std::size_t n) : widened(raw_data(x), raw_data(x) + n), data(widened.data()) {}
+};
+
+/// y = A x on the SELL-C-sigma matrix, vectorised across the C rows of a slice
+/** \param grain Minimum number of stored elements per thread */
+template <typename T, std::size_t C, typename index_t, typename X, typename Y>
+void spmv(const sell_matrix<T, C, index_t>& a, const X* x, Y* y, std::size_t grain = default_grain)
+{
+	typedef sparse_accumulator<T, X> acc;
+	typedef typename acc::acc_t acc_t;
+	const sell_gather<X> source(x, a.cols);
+	const std::size_t slices = a.slices();
+	const std::size_t chunks = chunk_count(a.values.size(), grain);
+	parallel_chunks(slices, chunks, [&](std::size_t, std::size_t begin, std::size_t end) {
+		const index_t* col = a.col_index.data();
+		const typename fixed_point_traits<T>::raw_t* val = raw_data(a.values.data());
+		const typename sell_gather<X>::gather_t* xs = source.data;
+		for (std::size_t s = begin; s < end; ++s) {
+			acc_t sum[C];
+			for (std::size_t r = 0; r < C; ++r) {
+				sum[r] = 0;
+			}
+			for (std::size_t e = a.slice_ptr[s]; e < a.slice_ptr[s + 1]; e += C) {
+				_FIXED_POINT_IVDEP_
+				for (std::size_t r = 0; r < C; ++r) {
+					sum[r] += static_cast<acc_t>(val[e + r]) * static_cast<acc_t>(xs[col[e + r]]);
+				}
+			}
+			for (std::size_t r = 0; r < C; ++r) {
+				const std::size_t i = a.slice_rows[s * C + r];
+				if (i < a.rows) {
+					y[i] = acc::template narrow<Y>(sum[r]);
+				}
+			}
+		}
+	});
+}
+
+} // namespace fxp
+
+#endif /* end of include guard: FIXED_POINT_SPARSE_HPP */
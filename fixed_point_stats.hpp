@@ -0,0 +1,526 @@
+/** Copyright 2026 Politecnico di Milano
+ * Developed by: Stefano Cherubin
+ * PhD student, Politecnico di Milano
+ * <first_name>.<family_name>@polimi.it
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIXED_POINT_STATS_HPP
+#define FIXED_POINT_STATS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "fixed_point_traits.hpp"
+
+namespace fxp {
+
+// Streaming statistics over fixed-point values, all in integer arithmetic.
+//
+// Moments are kept as exact sums of the raw values and of their squares in a
+// wide integer. With no rounding there is nothing to compensate for, so the
+// result does not depend on the order of the samples, and two accumulators
+// merge by adding their sums: each worker thread feeds its own instance and
+// the reader merges them, with no lock or atomic on the update path.
+
+//-----------------------------------------------------------------------------
+// MOMENTS
+//-----------------------------------------------------------------------------
+
+/// Integer types the statistics of T are accumulated in
+template <typename T>
+struct stats_traits
+{
+	typedef fixed_point_traits<T> traits;
+	typedef typename traits::raw_t raw_t;
+
+#ifdef _IS64bit
+	static const uint16_t acc_bits = 128;
+#else
+	static const uint16_t acc_bits = 64;
+#endif
+	static_assert(traits::is_fixed_point && 2 * traits::bit_width + 32 <= acc_bits,
+		"sums of squares of at least 2^31 values of T must fit the accumulator");
+
+	typedef typename get_int_with_length<acc_bits>::RESULT acc_t;
+	typedef typename get_uint_with_length<acc_bits>::RESULT uacc_t;
+
+	/// Format of a variance: squared raw units, twice the bits of T
+	typedef ufixed_point_t<2 * traits::integer_length, 2 * traits::fractional_length> variance_t;
+
+	/// Batches of up to block values have their sums taken in 64 bits first
+	static const bool blocked = 2 * traits::bit_width + 16 <= 62;
+	static const std::size_t block = std::size_t(1) << 16;
+};
+
+template <typename T>
+class sliding_window;
+
+/// Count, mean, variance, minimum and maximum of a stream of values of T
+/** The sum and the sum of squares are exact, so merge() of per-thread
+ *  instances gives the same result as a single instance fed every value.
+ *  Formats up to 32 bits wide, or 16 bits without 128-bit integers. */
+template <typename T>
+class running_stats
+{
+public:
+	typedef stats_traits<T> stats;
+	typedef typename stats::raw_t raw_t;
+	typedef typename stats::acc_t acc_t;
+	typedef typename stats::uacc_t uacc_t;
+	typedef typename stats::variance_t variance_t;
+
+	running_stats() { reset(); }
+
+	void reset() {
+		count_ = 0;
+		sum_ = 0;
+		sum_squares_ = 0;
+		min_ = fixed_point_traits<T>::max_raw();
+		max_ = fixed_point_traits<T>::min_raw();
+	}
+
+	void add(const T& value) {
+		const raw_t r = value.getRaw();
+		++count_;
+		sum_ += r;
+		sum_squares_ += static_cast<acc_t>(r) * r;
+		min_ = r < min_ ? r : min_;
+		max_ = r > max_ ? r : max_;
+	}
+
+	/// Add n values; narrow formats are summed by blocks in 64 bits, which vectorises
+	void add(const T* data, std::size_t n) {
+		if (!stats::blocked) {
+			for (std::size_t i = 0; i < n; ++i) {
+				add(data[i]);
+			}
+			return;
+		}
+		for (std::size_t begin = 0; begin < n; begin += stats::block) {
+			const std::size_t end = n - begin < stats::block ? n : begin + stats::block;
+			int64_t sum = 0;
+			int64_t squares = 0;
+			raw_t lo = min_;
+			raw_t hi = max_;
+			for (std::size_t i = begin; i < end; ++i) {
+				const raw_t r = data[i].getRaw();
+				sum += r;
+				squares += static_cast<int64_t>(r) * r;
+				lo = r < lo ? r : lo;
+				hi = r > hi ? r : hi;
+			}
+			count_ += end - begin;
+			sum_ += sum;
+			sum_squares_ += squares;
+			min_ = lo;
+			max_ = hi;
+		}
+	}
+
+	/// Add the values seen by other
+	void merge(const running_stats& other) {
+		count_ += other.count_;
+		sum_ += other.sum_;
+		sum_squares_ += other.sum_squares_;
+		min_ = other.min_ < min_ ? other.min_ : min_;
+		max_ = other.max_ > max_ ? other.max_ : max_;
+	}
+
+	uint64_t count() const { return count_; }
+	bool empty() const { return count_ == 0; }
+
+	/// Exact sum of the raw values
+	acc_t raw_sum() const { return sum_; }
+
+	/// Smallest value, zero if empty
+	T min() const { return T::createRaw(count_ > 0 ? min_ : raw_t(0)); }
+	/// Largest value, zero if empty
+	T max() const { return T::createRaw(count_ > 0 ? max_ : raw_t(0)); }
+
+	/// Mean rounded to nearest, zero if empty
+	T mean() const {
+		if (count_ == 0) {
+			return T::createRaw(0);
+		}
+		const acc_t n = static_cast<acc_t>(count_);
+		return T::createRaw(static_cast<raw_t>(floor_div(2 * sum_ + n, 2 * n)));
+	}
+
+	/// Sum of the squared deviations from the mean, in squared raw units, rounded down
+	uacc_t squared_deviations() const {
+		if (count_ == 0) {
+			return 0;
+		}
+		// sum^2 / n = q^2 n + 2 q r + r^2 / n with sum = q n + r, 0 <= r < n,
+		// which stays in the range of the sum of squares
+		const acc_t n = static_cast<acc_t>(count_);
+		const acc_t q = floor_div(sum_, n);
+		const uacc_t r = static_cast<uacc_t>(sum_ - q * n);
+		const uacc_t rr = r * r;
+		const uacc_t rr_over_n = rr / count_ + (rr % count_ != 0 ? 1 : 0);
+		return static_cast<uacc_t>(sum_squares_ - q * q * n - 2 * q * static_cast<acc_t>(r)) - rr_over_n;
+	}
+
+	/// Population variance, rounded to nearest, zero if empty
+	variance_t variance() const {
+		return divide(squared_deviations(), count_);
+	}
+
+	/// Sample variance, dividing by count() - 1, zero with fewer than two values
+	variance_t sample_variance() const {
+		return divide(squared_deviations(), count_ > 1 ? count_ - 1 : 0);
+	}
+
+	/// Population standard deviation rounded down, saturated to T
+	T stddev() const {
+		typedef typename fixed_point_traits<variance_t>::raw_t var_raw_t;
+		const var_raw_t root = isqrt<var_raw_t>(variance().getRaw());
+		const var_raw_t top = static_cast<var_raw_t>(fixed_point_traits<T>::max_raw());
+		return T::createRaw(static_cast<raw_t>(root < top ? root : top));
+	}
+
+private:
+	friend class sliding_window<T>;
+
+	// Largest integer not greater than a / b, b > 0
+	static acc_t floor_div(acc_t a, acc_t b) {
+		const acc_t q = a / b;
+		return (a % b != 0 && a < 0) ? q - 1 : q;
+	}
+
+	static variance_t divide(uacc_t deviations, uint64_t n) {
+		typedef typename fixed_point_traits<variance_t>::raw_t var_raw_t;
+		if (n == 0) {
+			return variance_t::createRaw(0);
+		}
+		return variance_t::createRaw(static_cast<var_raw_t>((deviations + n / 2) / n));
+	}
+
+	uint64_t count_;
+	acc_t sum_;
+	acc_t sum_squares_;
+	raw_t min_;
+	raw_t max_;
+};
+
+//-----------------------------------------------------------------------------
+// SLIDING WINDOW
+//-----------------------------------------------------------------------------
+
+/// Statistics of the last length values of a stream, O(1) per value
+/** The sums are updated by adding the new value and removing the oldest,
+ *  exactly, so they never drift however long the stream. The minimum and
+ *  the maximum come from monotonic queues, amortised O(1). */
+template <typename T>
+class sliding_window
+{
+public:
+	typedef typename running_stats<T>::raw_t raw_t;
+	typedef typename running_stats<T>::acc_t acc_t;
+	typedef typename running_stats<T>::variance_t variance_t;
+
+	explicit sliding_window(std::size_t length)
+		: values_(length > 0 ? length : 1), lows_(values_.size()), highs_(values_.size()) {
+		reset();
+	}
+
+	void reset() {
+		sequence_ = 0;
+		sum_ = 0;
+		sum_squares_ = 0;
+		lows_.clear();
+		highs_.clear();
+	}
+
+	void push(const T& value) {
+		const raw_t r = value.getRaw();
+		const std::size_t length = values_.size();
+		raw_t& slot = values_[static_cast<std::size_t>(sequence_ % length)];
+		if (sequence_ >= length) {
+			sum_ -= slot;
+			sum_squares_ -= static_cast<acc_t>(slot) * slot;
+			lows_.expire(sequence_ - length);
+			highs_.expire(sequence_ - length);
+		}
+		slot = r;
+		sum_ += r;
+		sum_squares_ += static_cast<acc_t>(r) * r;
+		lows_.push(sequence_, r, std::false_type());
+		highs_.push(sequence_, r, std::true_type());
+		++sequence_;
+	}
+
+	void push(const T* data, std::size_t n) {
+		for (std::size_t i = 0; i < n; ++i) {
+			push(data[i]);
+		}
+	}
+
+	/// Values in the window
+	std::size_t size() const { return sequence_ < values_.size() ? static_cast<std::size_t>(sequence_) : values_.size(); }
+	std::size_t length() const { return values_.size(); }
+	bool full() const { return sequence_ >= values_.size(); }
+
+	/// Statistics of the values in the window, to be read or merged
+	running_stats<T> stats() const {
+		running_stats<T> result;
+		result.count_ = size();
+		result.sum_ = sum_;
+		result.sum_squares_ = sum_squares_;
+		if (result.count_ > 0) {
+			result.min_ = lows_.front();
+			result.max_ = highs_.front();
+		}
+		return result;
+	}
+
+	T mean() const { return stats().mean(); }
+	variance_t variance() const { return stats().variance(); }
+	T stddev() const { return stats().stddev(); }
+	T min() const { return stats().min(); }
+	T max() const { return stats().max(); }
+
+private:
+	// Values that may still become the extremum of the window, in sequence
+	// order, kept in a ring as long as the window
+	class monotonic_queue
+	{
+	public:
+		explicit monotonic_queue(std::size_t capacity)
+			: sequences_(capacity), values_(capacity), head_(0), size_(0) {}
+
+		void clear() {
+			head_ = 0;
+			size_ = 0;
+		}
+
+		/// Drop the entries made dominated by value: smaller ones if MAX, larger ones otherwise
+		template <bool MAX>
+		void push(uint64_t sequence, raw_t value, std::integral_constant<bool, MAX>) {
+			while (size_ > 0) {
+				const raw_t last = values_[slot(size_ - 1)];
+				if (MAX ? last > value : last < value) {
+					break;
+				}
+				--size_;
+			}
+			sequences_[slot(size_)] = sequence;
+			values_[slot(size_)] = value;
+			++size_;
+		}
+
+		/// Drop the entry of sequence if it is the oldest
+		void expire(uint64_t sequence) {
+			if (size_ > 0 && sequences_[head_] == sequence) {
+				head_ = slot(1);
+				--size_;
+			}
+		}
+
+		raw_t front() const { return values_[head_]; }
+
+	private:
+		std::size_t slot(std::size_t i) const {
+			const std::size_t s = head_ + i;
+			return s < values_.size() ? s : s - values_.size();
+		}
+
+		std::vector<uint64_t> sequences_;
+		std::vector<raw_t> values_;
+		std::size_t head_;
+		std::size_t size_;
+	};
+
+	std::vector<raw_t> values_;
+	monotonic_queue lows_;
+	monotonic_queue highs_;
+	uint64_t sequence_;
+	acc_t sum_;
+	acc_t sum_squares_;
+};
+
+//-----------------------------------------------------------------------------
+// QUANTILES
+//-----------------------------------------------------------------------------
+
+/// Index of the highest set bit of a non-zero value
+inline int highest_bit(uint64_t x)
+{
+#if defined(__GNUC__)
+	return 63 - __builtin_clzll(x);
+#else
+	int bit = 0;
+	while (x >>= 1) {
+		++bit;
+	}
+	return bit;
+#endif
+}
+
+/// Mergeable quantile sketch over the raw values of T
+/** A histogram with logarithmic buckets on the magnitude of the raw value:
+ *  magnitudes below 2^PRECISION have a bucket each, larger ones are split
+ *  into 2^PRECISION buckets per power of two. A quantile is the middle of
+ *  its bucket, within a relative error of 2^-(PRECISION + 1), clamped to
+ *  the exact minimum and maximum. Buckets are counters, so sketches of
+ *  the same type merge exactly by adding them; the memory is fixed, about
+ *  (bit_width - PRECISION + 1) * 2^PRECISION counters per sign. */
+template <typename T, int PRECISION = 6>
+class quantile_sketch
+{
+	typedef fixed_point_traits<T> traits;
+	static_assert(traits::is_fixed_point && traits::bit_width <= 64, "the sketch keys on raw values up to 64 bits");
+	static_assert(PRECISION >= 1 && PRECISION <= 16, "between 2 and 65536 buckets per power of two");
+
+public:
+	typedef typename traits::raw_t raw_t;
+	typedef typename traits::uraw_t uraw_t;
+
+	/// Buckets of the magnitudes of one sign
+	static const std::size_t side_buckets = traits::bit_width > PRECISION
+		? std::size_t(traits::bit_width - PRECISION + 1) << PRECISION
+		: std::size_t(1) << traits::bit_width;
+	static const std::size_t buckets = traits::is_signed ? 2 * side_buckets : side_buckets;
+
+	quantile_sketch() : counts_(buckets, 0) { reset(); }
+
+	void reset() {
+		std::fill(counts_.begin(), counts_.end(), uint64_t(0));
+		count_ = 0;
+		min_ = traits::max_raw();
+		max_ = traits::min_raw();
+	}
+
+	void add(const T& value) {
+		const raw_t r = value.getRaw();
+		++counts_[bucket_of(r)];
+		++count_;
+		min_ = r < min_ ? r : min_;
+		max_ = r > max_ ? r : max_;
+	}
+
+	void add(const T* data, std::size_t n) {
+		for (std::size_t i = 0; i < n; ++i) {
+			add(data[i]);
+		}
+	}
+
+	/// Add the values seen by other
+	void merge(const quantile_sketch& other) {
+		for (std::size_t b = 0; b < buckets; ++b) {
+			counts_[b] += other.counts_[b];
+		}
+		count_ += other.count_;
+		min_ = other.min_ < min_ ? other.min_ : min_;
+		max_ = other.max_ > max_ ? other.max_ : max_;
+	}
+
+	uint64_t count() const { return count_; }
+	bool empty() const { return count_ == 0; }
+	T min() const { return T::createRaw(count_ > 0 ? min_ : raw_t(0)); }
+	T max() const { return T::createRaw(count_ > 0 ? max_ : raw_t(0)); }
+
+	/// Value of rank rank, from 1 to count(), zero if empty
+	T at_rank(uint64_t rank) const {
+		if (count_ == 0) {
+			return T::createRaw(0);
+		}
+		rank = rank < 1 ? 1 : (rank > count_ ? count_ : rank);
+		if (rank == 1) {
+			return min();
+		}
+		if (rank == count_) {
+			return max();
+		}
+		uint64_t seen = 0;
+		std::size_t b = 0;
+		for (; b + 1 < buckets; ++b) {
+			seen += counts_[b];
+			if (seen >= rank) {
+				break;
+			}
+		}
+		const raw_t value = middle_of(b);
+		return T::createRaw(value < min_ ? min_ : (value > max_ ? max_ : value));
+	}
+
+	/// Quantile num / den, e.g. quantile(99, 100) for the 99th percentile
+	/** The value of rank ceil(count() * num / den); num <= den < 2^32. */
+	T quantile(uint64_t num, uint64_t den) const {
+		if (den == 0) {
+			return T::createRaw(0);
+		}
+		const uint64_t whole = count_ / den * num;
+		const uint64_t part = count_ % den * num;
+		return at_rank(whole + part / den + (part % den != 0 ? 1 : 0));
+	}
+
+	/// Median, quantile(1, 2)
+	T median() const { return quantile(1, 2); }
+
+private:
+	static std::size_t magnitude_bucket(uraw_t m) {
+		if (m < (uraw_t(1) << PRECISION)) {
+			return static_cast<std::size_t>(m);
+		}
+		const int e = highest_bit(static_cast<uint64_t>(m));
+		return (std::size_t(e - PRECISION + 1) << PRECISION)
+			+ static_cast<std::size_t>(m >> (e - PRECISION)) - (std::size_t(1) << PRECISION);
+	}
+
+	// Negative values are mirrored below the non-negative ones, so that the
+	// bucket order is the order of the values
+	static std::size_t bucket_of(raw_t r) {
+		if (traits::is_signed && r < 0) {
+			return side_buckets - 1 - magnitude_bucket(static_cast<uraw_t>(uraw_t(0) - static_cast<uraw_t>(r)));
+		}
+		return (traits::is_signed ? side_buckets : 0) + magnitude_bucket(static_cast<uraw_t>(r));
+	}
+
+	static uraw_t magnitude_middle(std::size_t b) {
+		if (b < (std::size_t(1) << PRECISION)) {
+			return static_cast<uraw_t>(b);
+		}
+		const int group = static_cast<int>(b >> PRECISION);
+		const uraw_t mantissa = static_cast<uraw_t>((b & ((std::size_t(1) << PRECISION) - 1)) + (std::size_t(1) << PRECISION));
+		const uraw_t width = uraw_t(1) << (group - 1);
+		return static_cast<uraw_t>((mantissa << (group - 1)) + (width - 1) / 2);
+	}
+
+	static raw_t middle_of(std::size_t b) {
+		if (traits::is_signed && b < side_buckets) {
+			return static_cast<raw_t>(uraw_t(0) - magnitude_middle(side_buckets - 1 - b));
+		}
+		return static_cast<raw_t>(magnitude_middle(b - (traits::is_signed ? side_buckets : 0)));
+	}
+
+	std::vector<uint64_t> counts_;
+	uint64_t count_;
+	raw_t min_;
+	raw_t max_;
+};
+
+} // namespace fxp
+
+#endif /* end of include guard: FIXED_POINT_STATS_HPP */
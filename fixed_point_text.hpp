@@ -0,0 +1,511 @@
+/** Copyright 2026 Politecnico di Milano
+ * Developed by: Stefano Cherubin
+ * PhD student, Politecnico di Milano
+ * <first_name>.<family_name>@polimi.it
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIXED_POINT_TEXT_HPP
+#define FIXED_POINT_TEXT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#  define _FIXED_POINT_MMAP_ 1
+#endif
+
+#include "fixed_point_parallel.hpp"
+#include "fixed_point_traits.hpp"
+
+namespace fxp {
+
+// Decimal text straight to raw values, without strtod and the double
+// constructor: the integer part is accumulated exactly and the fraction is
+// converted with integer arithmetic, rounding to nearest, ties to even, so
+// the result is the correctly rounded value of the decimal, whatever the
+// number of digits.
+//
+// Bulk ingest of delimited text (CSV or whitespace separated columns) maps
+// the file, cuts it into chunks at line boundaries, counts the rows of
+// every chunk and then parses the chunks in parallel into preallocated
+// columns, every chunk knowing its first row.
+
+//-----------------------------------------------------------------------------
+// DECIMAL PARSING
+//-----------------------------------------------------------------------------
+
+/// round(digits[0, n) as a decimal fraction * 2^frac_bits), ties to even
+/** digits holds values 0 to 9 and is overwritten; sticky tells that nonzero
+ *  digits follow the n given, and integer_odd that the integer part is odd,
+ *  which breaks ties when frac_bits is 0. Keeping frac_bits + 1 digits and a sticky
+ *  flag is exact, as every halfway point has at most frac_bits + 1
+ *  fractional decimal digits. The result may be 2^frac_bits. */
+inline uint64_t decimal_fraction_bits(unsigned char* digits, int n, bool sticky, bool integer_odd, int frac_bits)
+{
+	while (n > 0 && digits[n - 1] == 0) {
+		--n;
+	}
+	if (n == 0) {
+		return 0;
+	}
+	if (n <= 19) {
+		// exact with one wide division
+		uint64_t numerator = 0, denominator = 1;
+		for (int k = 0; k < n; ++k) {
+			numerator = numerator * 10 + digits[k];
+			denominator *= 10;
+		}
+#ifdef _IS64bit
+		typedef unsigned __int128 wide_t;
+		const wide_t scaled = static_cast<wide_t>(numerator) << frac_bits;
+		const uint64_t q = static_cast<uint64_t>(scaled / denominator);
+		const wide_t r2 = 2 * (scaled % denominator);
+		return q + ((r2 > denominator || (r2 == denominator && (sticky || (frac_bits > 0 ? (q & 1) != 0 : integer_odd)))) ? 1 : 0);
+#else
+		if (frac_bits < 63 && numerator < (uint64_t(1) << (63 - frac_bits))) {
+			const uint64_t scaled = numerator << frac_bits;
+			const uint64_t q = scaled / denominator;
+			const uint64_t r2 = 2 * (scaled % denominator);
+			return q + ((r2 > denominator || (r2 == denominator && (sticky || (frac_bits > 0 ? (q & 1) != 0 : integer_odd)))) ? 1 : 0);
+		}
+#endif
+	}
+	// double the decimal fraction, one bit out of it each time
+	uint64_t q = 0;
+	bool half = false;
+	for (int b = 0; b <= frac_bits; ++b) {
+		unsigned carry = 0;
+		for (int k = n - 1; k >= 0; --k) {
+			const unsigned v = digits[k] * 2u + carry;
+			digits[k] = static_cast<unsigned char>(v >= 10 ? v - 10 : v);
+			carry = v >= 10 ? 1u : 0u;
+		}
+		if (b < frac_bits) {
+			q = (q << 1) | carry;
+		} else {
+			half = carry != 0;
+		}
+	}
+	for (int k = 0; k < n && !sticky; ++k) {
+		sticky = digits[k] != 0;
+	}
+	return q + ((half && (sticky || (frac_bits > 0 ? (q & 1) != 0 : integer_odd))) ? 1 : 0);
+}
+
+/// Parse a decimal number of [p, end) to out, correctly rounded to T
+/** Accepts an optional sign, digits with an optional decimal point and an
+ *  optional exponent, as in "-12.375" or "1.5e-3". p is moved past the
+ *  characters read. Returns false, leaving p unchanged, when no number
+ *  starts at p, and false with out saturated when the value is out of the
+ *  range of T. */
+template <typename T>
+bool parse_decimal(const char*& p, const char* end, T& out)
+{
+	typedef fixed_point_traits<T> traits;
+	static_assert(traits::bit_width <= 64, "parsed formats have at most 64 bits");
+	static const int frac_bits = traits::fractional_length;
+
+	const char* s = p;
+	bool negative = false;
+	if (s < end && (*s == '-' || *s == '+')) {
+		negative = *s == '-';
+		++s;
+	}
+	// mantissa digits, the decimal point after point_at of them
+	const char* digits_begin = s;
+	int count = 0, point_at = -1;
+	for (; s < end; ++s) {
+		if (*s >= '0' && *s <= '9') {
+			++count;
+		} else if (*s == '.' && point_at < 0) {
+			point_at = count;
+		} else {
+			break;
+		}
+	}
+	if (count == 0) {
+		return false;
+	}
+	const char* digits_end = s;
+	if (point_at < 0) {
+		point_at = count;
+	}
+	long exponent = 0;
+	if (s + 1 < end && (*s == 'e' || *s == 'E')) {
+		const char* e = s + 1;
+		bool exponent_negative = false;
+		if (*e == '-' || *e == '+') {
+			exponent_negative = *e == '-';
+			++e;
+		}
+		if (e < end && *e >= '0' && *e <= '9') {
+			for (; e < end && *e >= '0' && *e <= '9'; ++e) {
+				exponent = exponent < 100000 ? exponent * 10 + (*e - '0') : exponent;
+			}
+			exponent = exponent_negative ? -exponent : exponent;
+			s = e;
+		}
+	}
+	p = s;
+
+	// digit k of the mantissa has weight 10^(integer_digits - 1 - k)
+	const long integer_digits = point_at + exponent;
+	const uint64_t max_magnitude = negative
+		? static_cast<uint64_t>(-(static_cast<int64_t>(traits::min_raw()) + 1)) + 1
+		: static_cast<uint64_t>(traits::max_raw());
+	const uint64_t max_integer = frac_bits < 64 ? max_magnitude >> frac_bits : 0;
+	uint64_t integer = 0;
+	bool overflow = false;
+	unsigned char fraction[frac_bits + 2] = {0};
+	int fraction_digits = 0;
+	bool sticky = false;
+	long k = 0;
+	for (const char* c = digits_begin; c < digits_end; ++c) {
+		if (*c == '.') {
+			continue;
+		}
+		const unsigned d = static_cast<unsigned>(*c - '0');
+		if (k < integer_digits) {
+			if (integer > max_integer / 10 || integer * 10 + d > max_integer) {
+				overflow = true;
+			} else {
+				integer = integer * 10 + d;
+			}
+		} else {
+			const long position = k - integer_digits;
+			if (position <= frac_bits) {
+				fraction[position] = static_cast<unsigned char>(d);
+				fraction_digits = static_cast<int>(position) + 1;
+			} else {
+				sticky = sticky || d != 0;
+			}
+		}
+		++k;
+	}
+	// zeros implied by a positive exponent
+	for (; k < integer_digits && integer != 0 && !overflow; ++k) {
+		overflow = integer > max_integer / 10;
+		integer *= 10;
+	}
+
+	const uint64_t fraction_raw = decimal_fraction_bits(fraction, fraction_digits, sticky, (integer & 1) != 0, frac_bits);
+	const uint64_t magnitude = (frac_bits < 64 ? integer << (frac_bits < 64 ? frac_bits : 0) : 0) + fraction_raw;
+	overflow = overflow || magnitude > max_magnitude || magnitude < fraction_raw;
+	if (overflow) {
+		out = T::createRaw(negative ? traits::min_raw() : traits::max_raw());
+		return false;
+	}
+	out = T::createRaw(static_cast<typename traits::raw_t>(negative ? 0 - magnitude : magnitude));
+	return true;
+}
+
+//-----------------------------------------------------------------------------
+// FILES
+//-----------------------------------------------------------------------------
+
+/// Read-only view of a whole file, memory mapped where the platform allows
+class mapped_file
+{
+public:
+	explicit mapped_file(const char* path) : data_(nullptr), size_(0), mapped_(false), valid_(false) {
+#ifdef _FIXED_POINT_MMAP_
+		const int fd = ::open(path, O_RDONLY);
+		if (fd >= 0) {
+			struct stat st = {};
+			const bool known = ::fstat(fd, &st) == 0;
+			if (known && st.st_size > 0) {
+				void* address = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+				if (address != MAP_FAILED) {
+					::madvise(address, static_cast<std::size_t>(st.st_size), MADV_SEQUENTIAL);
+					data_ = static_cast<const char*>(address);
+					size_ = static_cast<std::size_t>(st.st_size);
+					mapped_ = true;
+				}
+			}
+			::close(fd);
+			// an empty file is done, an unknown size falls back to reading
+			if (mapped_ || (known && st.st_size == 0)) {
+				valid_ = true;
+				return;
+			}
+		}
+#endif
+		std::ifstream file(path, std::ios::binary);
+		if (file) {
+			// read() sets badbit on errors, e.g. for a directory, rather than throwing
+			char chunk[1 << 16];
+			while (file.read(chunk, sizeof(chunk)) || file.gcount() > 0) {
+				buffer_.insert(buffer_.end(), chunk, chunk + file.gcount());
+			}
+			data_ = buffer_.data();
+			size_ = buffer_.size();
+			valid_ = !file.bad();
+		}
+	}
+
+	~mapped_file() {
+#ifdef _FIXED_POINT_MMAP_
+		if (mapped_) {
+			::munmap(const_cast<char*>(data_), size_);
+		}
+#endif
+	}
+
+	mapped_file(const mapped_file&) = delete;
+	mapped_file& operator=(const mapped_file&) = delete;
+
+	/// False when the file could not be opened or read
+	bool valid() const { return valid_; }
+	const char* data() const { return data_; }
+	std::size_t size() const { return size_; }
+
+private:
+	const char* data_;
+	std::size_t size_;
+	bool mapped_;
+	bool valid_;
+	std::vector<char> buffer_;
+};
+
+//-----------------------------------------------------------------------------
+// DELIMITED TEXT
+//-----------------------------------------------------------------------------
+
+/// Rows and fields of a parse; errors counts fields missing, malformed or out of range
+struct ingest_result
+{
+	std::size_t rows;
+	std::size_t errors;
+};
+
+/// Space, tab or carriage return
+inline bool is_blank(char c)
+{
+	return c == ' ' || c == '\t' || c == '\r';
+}
+
+/// End of the line starting at p, at the newline or at end
+inline const char* line_end(const char* p, const char* end)
+{
+	const void* newline = std::memchr(p, '\n', static_cast<std::size_t>(end - p));
+	return newline != nullptr ? static_cast<const char*>(newline) : end;
+}
+
+/// True for lines of blanks only, which are not rows
+inline bool blank_line(const char* p, const char* end)
+{
+	for (; p < end; ++p) {
+		if (!is_blank(*p)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/// Text after the first skip lines
+inline const char* skip_lines(const char* p, const char* end, std::size_t skip)
+{
+	for (; skip > 0 && p < end; --skip) {
+		const char* e = line_end(p, end);
+		p = e < end ? e + 1 : end;
+	}
+	return p;
+}
+
+/// Starts of chunks + 1 pieces of [begin, end) cut after newlines, end last
+inline std::vector<const char*> line_chunks(const char* begin, const char* end, std::size_t chunks)
+{
+	std::vector<const char*> starts(chunks + 1, end);
+	starts[0] = begin;
+	const std::size_t size = static_cast<std::size_t>(end - begin);
+	for (std::size_t c = 1; c < chunks; ++c) {
+		const char* p = begin + chunk_begin(size, chunks, c);
+		p = p > starts[c - 1] ? p : starts[c - 1];
+		if (p > begin && p < end && p[-1] != '\n') {
+			const char* e = line_end(p, end);
+			p = e < end ? e + 1 : end;
+		}
+		starts[c] = p;
+	}
+	return starts;
+}
+
+/// Rows, i.e. lines not blank, of [begin, end)
+inline std::size_t count_rows(const char* begin, const char* end)
+{
+	std::size_t rows = 0;
+	while (begin < end) {
+		const char* e = line_end(begin, end);
+		rows += blank_line(begin, e) ? 0 : 1;
+		begin = e < end ? e + 1 : end;
+	}
+	return rows;
+}
+
+/// Row of the first row of every chunk between starts, the total last
+inline std::vector<std::size_t> chunk_rows(const std::vector<const char*>& starts)
+{
+	const std::size_t chunks = starts.size() - 1;
+	std::vector<std::size_t> first_row(chunks + 1, 0);
+	parallel_chunks(chunks, chunks, [&](std::size_t c, std::size_t, std::size_t) {
+		first_row[c + 1] = count_rows(starts[c], starts[c + 1]);
+	});
+	for (std::size_t c = 0; c < chunks; ++c) {
+		first_row[c + 1] += first_row[c];
+	}
+	return first_row;
+}
+
+/// Parse the rows of [begin, end) into columns[c][first_row + r]
+/** delimiter 0 separates fields by blanks. Fields after the ncols first
+ *  are ignored; a missing or bad field is stored as the value parsed so far
+ *  (zero if none) and counted as an error. */
+template <typename T>
+ingest_result parse_rows(const char* begin, const char* end, T* const* columns, std::size_t ncols,
+	std::size_t first_row, std::size_t capacity, char delimiter)
+{
+	ingest_result result = {0, 0};
+	std::size_t row = first_row;
+	while (begin < end) {
+		const char* e = line_end(begin, end);
+		if (blank_line(begin, e)) {
+			begin = e < end ? e + 1 : end;
+			continue;
+		}
+		if (row >= capacity) {
+			result.errors += ncols;
+			++result.rows;
+			begin = e < end ? e + 1 : end;
+			continue;
+		}
+		const char* p = begin;
+		for (std::size_t c = 0; c < ncols; ++c) {
+			while (p < e && is_blank(*p)) {
+				++p;
+			}
+			T value = T::createRaw(0);
+			bool good = parse_decimal(p, e, value);
+			while (p < e && is_blank(*p)) {
+				++p;
+			}
+			if (delimiter != 0 && p < e) {
+				good = good && *p == delimiter;
+				// move to the next field even after garbage
+				while (p < e && *p != delimiter) {
+					++p;
+				}
+				p += p < e ? 1 : 0;
+			} else if (delimiter == 0 && p < e && (!good || !is_blank(p[-1]))) {
+				// garbage in or right after the field
+				good = false;
+				while (p < e && !is_blank(*p)) {
+					++p;
+				}
+			}
+			columns[c][row] = value;
+			result.errors += good ? 0 : 1;
+		}
+		++row;
+		++result.rows;
+		begin = e < end ? e + 1 : end;
+	}
+	return result;
+}
+
+/// Parse the chunks between starts, of line_chunks(), whose rows chunk_rows() numbered
+/** For callers that count the rows before allocating the columns. */
+template <typename T>
+ingest_result parse_columns(const std::vector<const char*>& starts, const std::vector<std::size_t>& first_row,
+	T* const* columns, std::size_t ncols, std::size_t capacity, char delimiter = ',')
+{
+	const std::size_t chunks = starts.size() - 1;
+	std::vector<ingest_result> results(chunks);
+	parallel_chunks(chunks, chunks, [&](std::size_t c, std::size_t, std::size_t) {
+		results[c] = parse_rows(starts[c], starts[c + 1], columns, ncols, first_row[c], capacity, delimiter);
+	});
+	ingest_result total = {0, 0};
+	for (std::size_t c = 0; c < chunks; ++c) {
+		total.rows += results[c].rows;
+		total.errors += results[c].errors;
+	}
+	return total;
+}
+
+/// Parse delimited text into ncols preallocated columns of capacity values
+/** The first skip lines (headers) are ignored. Chunks of about grain bytes
+ *  are counted, then parsed, in parallel. rows is the number of rows of
+ *  the text; rows past capacity are not stored and their fields are
+ *  counted as errors. */
+template <typename T>
+ingest_result parse_columns(const char* text, std::size_t size, T* const* columns, std::size_t ncols,
+	std::size_t capacity, char delimiter = ',', std::size_t skip = 0, std::size_t grain = std::size_t(1) << 20)
+{
+	const char* end = text + size;
+	const char* begin = skip_lines(text, end, skip);
+	const std::vector<const char*> starts = line_chunks(begin, end, chunk_count(static_cast<std::size_t>(end - begin), grain));
+	return parse_columns(starts, chunk_rows(starts), columns, ncols, capacity, delimiter);
+}
+
+/// Load ncols columns of the delimited text file path into columns
+/** Rows are counted first, so every column is allocated once. Returns
+ *  false, with columns empty, when the file cannot be opened or read. */
+template <typename T>
+bool load_columns(const char* path, std::vector< std::vector<T> >& columns, std::size_t ncols,
+	char delimiter = ',', std::size_t skip = 0, ingest_result* result = nullptr)
+{
+	const mapped_file file(path);
+	const ingest_result none = {0, 0};
+	if (result != nullptr) {
+		*result = none;
+	}
+	columns.clear();
+	if (!file.valid()) {
+		return false;
+	}
+	const char* end = file.data() + file.size();
+	const char* begin = skip_lines(file.data(), end, skip);
+	const std::vector<const char*> starts = line_chunks(begin, end,
+		chunk_count(static_cast<std::size_t>(end - begin), std::size_t(1) << 20));
+	const std::vector<std::size_t> first_row = chunk_rows(starts);
+	const std::size_t rows = first_row.back();
+
+	columns.assign(ncols, std::vector<T>(rows));
+	std::vector<T*> pointers(ncols);
+	for (std::size_t c = 0; c < ncols; ++c) {
+		pointers[c] = columns[c].data();
+	}
+	const ingest_result parsed = parse_columns(starts, first_row, pointers.data(), ncols, rows, delimiter);
+	if (result != nullptr) {
+		*result = parsed;
+	}
+	return true;
+}
+
+} // namespace fxp
+
+#endif /* end of include guard: FIXED_POINT_TEXT_HPP */
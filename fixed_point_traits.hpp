@@ -0,0 +1,375 @@
+/** Copyright 2026 Politecnico di Milano
+ * Developed by: Stefano Cherubin
+ * PhD student, Politecnico di Milano
+ * <first_name>.<family_name>@polimi.it
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef FIXED_POINT_TRAITS_HPP
+#define FIXED_POINT_TRAITS_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+#if __cplusplus >= 202002L
+#include <span>
+#endif
+
+#include "fixed_point.hpp"
+#include "ufixed_point.hpp"
+
+namespace fxp {
+
+// C++14 relaxes the rules for constexpr functions, which lets loops and local
+// variables appear in compile-time evaluated helpers
+#if __cplusplus >= 201402L
+#  define _FIXED_POINT_CONSTEXPR14_ constexpr
+#else
+#  define _FIXED_POINT_CONSTEXPR14_ inline
+#endif
+
+// Tell the vectoriser that the next loop carries no dependency between
+// iterations, so that no run-time alias check is needed to vectorise it
+#if defined(__clang__)
+#  define _FIXED_POINT_IVDEP_ _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__)
+#  define _FIXED_POINT_IVDEP_ _Pragma("GCC ivdep")
+#else
+#  define _FIXED_POINT_IVDEP_
+#endif
+
+/// Size of a cache line on the x86 and x86_64 targets, used for padding
+const std::size_t cache_line_size = 64;
+
+//-----------------------------------------------------------------------------
+// TYPE TRAITS
+//-----------------------------------------------------------------------------
+
+/// Compile-time description of a fixed-point type
+/** Only fixed_point_t and ufixed_point_t are described, for any other type
+ *  is_fixed_point is false and no other member is defined. */
+template <typename T>
+struct fixed_point_traits
+{
+	static const bool is_fixed_point = false;
+};
+
+template <uint16_t INT_BITS, uint16_t FRAC_BITS>
+struct fixed_point_traits< fixed_point_t<INT_BITS, FRAC_BITS> >
+{
+	static const bool is_fixed_point = true;
+	static const bool is_signed = true;
+
+	static_assert(std::is_trivial< fixed_point_t<INT_BITS, FRAC_BITS> >::value,
+		"fixed-point types must be trivial");
+	static_assert(std::is_standard_layout< fixed_point_t<INT_BITS, FRAC_BITS> >::value,
+		"fixed-point types must be standard layout");
+	static_assert(sizeof(fixed_point_t<INT_BITS, FRAC_BITS>) == sizeof(typename fixed_point_t<INT_BITS, FRAC_BITS>::raw_t),
+		"fixed-point types must have the size of their raw value");
+	static const uint16_t integer_length = INT_BITS;
+	static const uint16_t fractional_length = FRAC_BITS;
+	static const uint16_t bit_width = INT_BITS + FRAC_BITS;
+
+	typedef fixed_point_t<INT_BITS, FRAC_BITS> value_t;
+	typedef typename value_t::raw_t raw_t;
+
+	/// Same family of fixed-point type, in a different format
+	template <uint16_t INT_BITS_NEW, uint16_t FRAC_BITS_NEW>
+	struct rebind { typedef fixed_point_t<INT_BITS_NEW, FRAC_BITS_NEW> RESULT; };
+
+	/// Unsigned integer type of the same size of raw_t
+	typedef typename get_uint_with_length<INT_BITS + FRAC_BITS>::RESULT uraw_t;
+
+	/// Integer type holding the exact product of two raw values
+	typedef typename get_int_with_length<2 * (INT_BITS + FRAC_BITS)>::RESULT wide_t;
+	typedef typename get_uint_with_length<2 * (INT_BITS + FRAC_BITS)>::RESULT uwide_t;
+
+	/// Largest raw value representable on bit_width bits
+	static raw_t max_raw() {
+		return static_cast<raw_t>((static_cast<uraw_t>(1) << (bit_width - 1)) - 1);
+	}
+
+	/// Smallest raw value representable on bit_width bits
+	static raw_t min_raw() {
+		return static_cast<raw_t>(-max_raw() - 1);
+	}
+};
+
+template <uint16_t INT_BITS, uint16_t FRAC_BITS>
+struct fixed_point_traits< ufixed_point_t<INT_BITS, FRAC_BITS> >
+{
+	static const bool is_fixed_point = true;
+	static const bool is_signed = false;
+
+	static_assert(std::is_trivial< ufixed_point_t<INT_BITS, FRAC_BITS> >::value,
+		"fixed-point types must be trivial");
+	static_assert(std::is_standard_layout< ufixed_point_t<INT_BITS, FRAC_BITS> >::value,
+		"fixed-point types must be standard layout");
+	static_assert(sizeof(ufixed_point_t<INT_BITS, FRAC_BITS>) == sizeof(typename ufixed_point_t<INT_BITS, FRAC_BITS>::raw_t),
+		"fixed-point types must have the size of their raw value");
+	static const uint16_t integer_length = INT_BITS;
+	static const uint16_t fractional_length = FRAC_BITS;
+	static const uint16_t bit_width = INT_BITS + FRAC_BITS;
+
+	typedef ufixed_point_t<INT_BITS, FRAC_BITS> value_t;
+	typedef typename value_t::raw_t raw_t;
+
+	/// Same family of fixed-point type, in a different format
+	template <uint16_t INT_BITS_NEW, uint16_t FRAC_BITS_NEW>
+	struct rebind { typedef ufixed_point_t<INT_BITS_NEW, FRAC_BITS_NEW> RESULT; };
+
+	typedef raw_t uraw_t;
+
+	/// Integer type holding the exact product of two raw values
+	typedef typename get_uint_with_length<2 * (INT_BITS + FRAC_BITS)>::RESULT wide_t;
+	typedef wide_t uwide_t;
+
+	/// Largest raw value representable on bit_width bits
+	static raw_t max_raw() {
+		// shift in two steps to stay defined when bit_width == sizeof(raw_t)*8
+		return static_cast<raw_t>(((static_cast<raw_t>(1) << (bit_width - 1)) << 1) - 1);
+	}
+
+	/// Smallest raw value representable on bit_width bits
+	static raw_t min_raw() {
+		return 0;
+	}
+};
+
+//-----------------------------------------------------------------------------
+// RAW VIEWS
+//-----------------------------------------------------------------------------
+
+// A fixed-point type is trivial, standard layout and as large as its raw
+// value (checked by fixed_point_traits), hence a pointer to it is
+// interconvertible with a pointer to its raw value and an array of T has the
+// same representation of an array of raw_t. These are the sanctioned ways to
+// look at the raw storage of fixed-point arrays, e.g. for SIMD or file I/O.
+
+/// Raw values of the array data
+template <typename T>
+typename fixed_point_traits<T>::raw_t* raw_data(T* data)
+{
+	return reinterpret_cast<typename fixed_point_traits<T>::raw_t*>(data);
+}
+
+template <typename T>
+const typename fixed_point_traits<T>::raw_t* raw_data(const T* data)
+{
+	return reinterpret_cast<const typename fixed_point_traits<T>::raw_t*>(data);
+}
+
+/// Fixed-point array stored in the raw values data
+template <typename T>
+T* from_raw_data(typename fixed_point_traits<T>::raw_t* data)
+{
+	return reinterpret_cast<T*>(data);
+}
+
+template <typename T>
+const T* from_raw_data(const typename fixed_point_traits<T>::raw_t* data)
+{
+	return reinterpret_cast<const T*>(data);
+}
+
+#if __cplusplus >= 202002L
+/// Raw values of the array data, as a span
+template <typename T>
+std::span<typename fixed_point_traits<T>::raw_t> raw_span(T* data, std::size_t n)
+{
+	return std::span<typename fixed_point_traits<T>::raw_t>(raw_data(data), n);
+}
+
+template <typename T>
+std::span<const typename fixed_point_traits<T>::raw_t> raw_span(const T* data, std::size_t n)
+{
+	return std::span<const typename fixed_point_traits<T>::raw_t>(raw_data(data), n);
+}
+
+template <typename T>
+std::span<typename fixed_point_traits<T>::raw_t> raw_span(std::span<T> data)
+{
+	return raw_span(data.data(), data.size());
+}
+
+template <typename T>
+std::span<const typename fixed_point_traits<T>::raw_t> raw_span(std::span<const T> data)
+{
+	return raw_span(data.data(), data.size());
+}
+#endif
+
+//-----------------------------------------------------------------------------
+// SATURATING RAW ARITHMETIC
+//-----------------------------------------------------------------------------
+
+/// Add two raw values of T, clamping the result to the range of T
+template <typename T>
+typename fixed_point_traits<T>::raw_t saturate_add(
+	typename fixed_point_traits<T>::raw_t a,
+	typename fixed_point_traits<T>::raw_t b)
+{
+	typedef fixed_point_traits<T> traits;
+	if (b > 0 && a > traits::max_raw() - b) {
+		return traits::max_raw();
+	}
+	if (b < 0 && a < traits::min_raw() - b) {
+		return traits::min_raw();
+	}
+	return a + b;
+}
+
+/// Subtract two raw values of T, clamping the result to the range of T
+template <typename T>
+typename fixed_point_traits<T>::raw_t saturate_sub(
+	typename fixed_point_traits<T>::raw_t a,
+	typename fixed_point_traits<T>::raw_t b)
+{
+	typedef fixed_point_traits<T> traits;
+	if (b > 0 && a < traits::min_raw() + b) {
+		return traits::min_raw();
+	}
+	if (b < 0 && a > traits::max_raw() + b) {
+		return traits::max_raw();
+	}
+	return a - b;
+}
+
+//-----------------------------------------------------------------------------
+// MIXED FORMAT PRODUCTS
+//-----------------------------------------------------------------------------
+
+/// Format holding the exact product of a value of A and a value of B
+/** Signed unless both factors are unsigned. */
+template <typename A, typename B>
+struct product_format
+{
+	typedef fixed_point_traits<A> traits_a;
+	typedef fixed_point_traits<B> traits_b;
+
+	static const bool is_signed = traits_a::is_signed || traits_b::is_signed;
+	static const uint16_t integer_length = traits_a::integer_length + traits_b::integer_length;
+	static const uint16_t fractional_length = traits_a::fractional_length + traits_b::fractional_length;
+
+	typedef typename std::conditional<is_signed,
+		fixed_point_t<integer_length, fractional_length>,
+		ufixed_point_t<integer_length, fractional_length> >::type RESULT;
+
+	/// Integer type the raw product is computed in, at most 128 bits wide
+	static const uint16_t op_bits = (integer_length + fractional_length > 128) ? 128 : integer_length + fractional_length;
+	typedef typename std::conditional<is_signed,
+		typename get_int_with_length<op_bits>::RESULT,
+		typename get_uint_with_length<op_bits>::RESULT>::type op_t;
+	typedef typename get_uint_with_length<op_bits>::RESULT uop_t;
+};
+
+/// Integer accumulating exact products of A and B raw values
+/** The products have the exact product format; 16 guard bits more, at
+ *  most 128 bits in total, keep sums of up to 65536 full scale products
+ *  exact. */
+template <typename A, typename B>
+struct product_accumulator
+{
+	typedef product_format<A, B> product;
+
+	static const uint16_t product_bits = fixed_point_traits<A>::bit_width + fixed_point_traits<B>::bit_width;
+	static const uint16_t bits = product_bits + 16 < 128 ? product_bits + 16 : 128;
+	static const uint16_t frac_bits = product::fractional_length;
+
+	typedef typename std::conditional<product::is_signed,
+		typename get_int_with_length<bits>::RESULT,
+		typename get_uint_with_length<bits>::RESULT>::type acc_t;
+
+	static acc_t product_of(const A& a, const B& b) {
+		return static_cast<acc_t>(a.getRaw()) * static_cast<acc_t>(b.getRaw());
+	}
+
+	/// Accumulated value truncated to Y
+	template <typename Y>
+	static Y narrow(acc_t acc) {
+		typedef typename fixed_point_traits<Y>::raw_t raw_t;
+		static const int shift = static_cast<int>(frac_bits) - fixed_point_traits<Y>::fractional_length;
+		return Y::createRaw(shift >= 0
+			? static_cast<raw_t>(acc >> (shift >= 0 ? shift : 0))
+			: static_cast<raw_t>(static_cast<raw_t>(acc) << (shift < 0 ? -shift : 0)));
+	}
+};
+
+/// Format holding the exact sum, or difference if SUB, of a value of A and a value of B
+/** Differences are always signed, and an unsigned operand takes one more
+ *  integer bit when the result is signed. */
+template <typename A, typename B, bool SUB = false>
+struct sum_format
+{
+	typedef fixed_point_traits<A> traits_a;
+	typedef fixed_point_traits<B> traits_b;
+
+	static const bool is_signed = SUB || traits_a::is_signed || traits_b::is_signed;
+	static const uint16_t integer_a = traits_a::integer_length + ((is_signed && !traits_a::is_signed) ? 1 : 0);
+	static const uint16_t integer_b = traits_b::integer_length + ((is_signed && !traits_b::is_signed) ? 1 : 0);
+	static const uint16_t integer_length = get_max<integer_a, integer_b>::RESULT + 1;
+	static const uint16_t fractional_length = get_max<traits_a::fractional_length, traits_b::fractional_length>::RESULT;
+
+	typedef typename std::conditional<is_signed,
+		fixed_point_t<integer_length, fractional_length>,
+		ufixed_point_t<integer_length, fractional_length> >::type RESULT;
+};
+
+/// Value v in the format R, of either family
+/** Same truncation and wrapping of convert<INT_BITS, FRAC_BITS>(), which
+ *  only converts within a family. */
+template <typename R, typename V>
+R convert_to(const V& v)
+{
+	static const uint16_t frac_v = fixed_point_traits<V>::fractional_length;
+	static const uint16_t frac_r = fixed_point_traits<R>::fractional_length;
+	return R::createRaw(convert_fixed_point<
+		typename fixed_point_traits<V>::raw_t,
+		typename fixed_point_traits<R>::raw_t,
+		get_max<frac_r, frac_v>::RESULT - get_min<frac_r, frac_v>::RESULT,
+		(frac_r > frac_v)>::exec(v.getRaw()));
+}
+
+/// Product a * b truncated to the format R
+/** The exact product is shifted once to the fractional bits of R, rounding
+ *  towards minus infinity like operator*, and wraps on the bits of R. When
+ *  the exact product needs more than 128 bits its top bits are lost. */
+template <typename R, typename A, typename B>
+R multiply_to(const A& a, const B& b)
+{
+	typedef product_format<A, B> product;
+	typedef typename product::op_t op_t;
+	typedef typename product::uop_t uop_t;
+	typedef typename fixed_point_traits<R>::raw_t raw_t;
+	static const int shift = static_cast<int>(product::fractional_length) - fixed_point_traits<R>::fractional_length;
+
+	// unsigned multiplication wraps instead of overflowing, at least as wide as unsigned int to escape integer promotion
+	typedef typename std::common_type<uop_t, unsigned int>::type mul_t;
+	const mul_t prod_bits = static_cast<mul_t>(static_cast<uop_t>(static_cast<op_t>(a.getRaw())))
+		* static_cast<mul_t>(static_cast<uop_t>(static_cast<op_t>(b.getRaw())));
+	const op_t prod = static_cast<op_t>(static_cast<uop_t>(prod_bits));
+	return R::createRaw(shift >= 0
+		? static_cast<raw_t>(prod >> (shift >= 0 ? shift : 0))
+		: static_cast<raw_t>(static_cast<uop_t>(prod) << (shift < 0 ? -shift : 0)));
+}
+
+} // namespace fxp
+
+#endif /* end of include guard: FIXED_POINT_TRAITS_HPP */
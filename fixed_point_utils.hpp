@@ -167,4 +167,72 @@ struct convert_fixed_point<src_t, dst_t, sha, false> {
 	}
 };
 
+//-----------------------------------------------------------------------------
+// ROUNDING TEMPLATES
+//-----------------------------------------------------------------------------
+
+/// Integer-only rounding of a raw value with FRAC_BITS fractional bits
+/** Every function returns a raw value whose fractional bits are zero.
+ *  Arithmetic is carried out on the unsigned counterpart of raw_t, so results
+ *  which do not fit the format wrap around as the arithmetic operators do. */
+template<typename raw_t, uint16_t FRAC_BITS>
+struct round_fixed_point {
+	typedef typename get_uint_with_length<sizeof(raw_t) * 8>::RESULT uraw_t;
+
+	/// Bit mask of the fractional part
+	static uraw_t frac_mask() {
+		return (static_cast<uraw_t>(1) << FRAC_BITS) - 1;
+	}
+
+	/// Largest integer not greater than the value
+	static raw_t floor(raw_t raw) {
+		// clearing the fractional bits of a two's complement number rounds down
+		return static_cast<raw_t>(static_cast<uraw_t>(raw) & ~frac_mask());
+	}
+
+	/// Smallest integer not less than the value
+	static raw_t ceil(raw_t raw) {
+		return floor(static_cast<raw_t>(static_cast<uraw_t>(raw) + frac_mask()));
+	}
+
+	/// Integer part, rounding towards zero
+	static raw_t trunc(raw_t raw) {
+		return raw < 0 ? ceil(raw) : floor(raw);
+	}
+
+	/// Closest integer, rounding half away from zero as std::round does
+	static raw_t round(raw_t raw) {
+		const uraw_t half = frac_mask() - (frac_mask() >> 1);
+		const uraw_t bias = (raw < 0 && FRAC_BITS > 0) ? half - 1 : half;
+		return floor(static_cast<raw_t>(static_cast<uraw_t>(raw) + bias));
+	}
+};
+
+//-----------------------------------------------------------------------------
+// INTEGER HELPERS
+//-----------------------------------------------------------------------------
+
+/// Floor of the square root of an unsigned integer
+/** Digit-by-digit method, one iteration every two bits of uint_t, no float
+ *  involved. The square root of a raw value with 2F fractional bits is the
+ *  raw value of the result with F fractional bits. */
+template<typename uint_t>
+uint_t isqrt(uint_t value) {
+	uint_t res = 0;
+	uint_t bit = static_cast<uint_t>(static_cast<uint_t>(1) << (sizeof(uint_t) * 8 - 2));
+	while (bit > value) {
+		bit >>= 2;
+	}
+	while (bit != 0) {
+		if (value >= res + bit) {
+			value -= res + bit;
+			res = (res >> 1) + bit;
+		} else {
+			res >>= 1;
+		}
+		bit >>= 2;
+	}
+	return res;
+}
+
 #endif /* end of include guard: FIXED_POINT_UTILS_HPP */
@@ -0,0 +1,239 @@
+/** Copyright 2026 Politecnico di Milano
+ * Developed by: Stefano Cherubin
+ * PhD student, Politecnico di Milano
+ * <first_name>.<family_name>@polimi.it
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+ * OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Producer/consumer check of the shared rings of fixed_point_shm.hpp across
+// processes. Producers and consumers are forked and attach to the segment by
+// name; every value carries its producer and sequence number, so consumers
+// check that each producer's values arrive once and in order. The exit status
+// is the number of failed checks.
+//
+//   g++ -std=c++11 -O2 -pthread -I. tests/fixed_point_shm_test.cpp -o shm_test -lrt
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "fixed_point.hpp"
+#include "ufixed_point.hpp"
+#include "fixed_point_shm.hpp"
+
+using namespace fxp;
+
+typedef fixed_point_t<16, 16> sample_t;
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const char* what) {
+	if (!condition) {
+		std::printf("FAILED: %s\n", what);
+		++failures;
+	}
+}
+
+/// Raw value of the sequence-th value of producer, sequences below 2^24
+int32_t encode(int producer, uint32_t sequence) {
+	return static_cast<int32_t>((static_cast<uint32_t>(producer) << 24) | sequence);
+}
+
+/// Counters shared by the forked consumers
+struct tally
+{
+	std::atomic<uint64_t> consumed;
+	std::atomic<uint64_t> errors;
+};
+
+//-----------------------------------------------------------------------------
+// SEGMENT CHECKS
+//-----------------------------------------------------------------------------
+
+void check_attach(const char* name) {
+	shared_ring<sample_t, spsc>::remove(name);
+	shared_ring<sample_t, spsc> ring = shared_ring<sample_t, spsc>::create(name, 1000);
+	check(ring.valid(), "create");
+	check(ring.capacity() == 1024, "capacity rounded up to a power of two");
+	check(ring.size() == 0, "new ring is empty");
+	check(!shared_ring<sample_t, spsc>::create(name, 16).valid(), "create of an existing segment fails");
+
+	check(shared_ring<sample_t, spsc>::attach(name).valid(), "attach with the same format");
+	check(!shared_ring<fixed_point_t<8, 24>, spsc>::attach(name).valid(), "attach rejects other fractional bits");
+	check(!shared_ring<fixed_point_t<8, 8>, spsc>::attach(name).valid(), "attach rejects another width");
+	check(!shared_ring<ufixed_point_t<16, 16>, spsc>::attach(name).valid(), "attach rejects another signedness");
+	check(!shared_ring<sample_t, mpmc>::attach(name).valid(), "attach rejects another ring kind");
+
+	check(shared_ring<sample_t, spsc>::remove(name), "remove");
+	check(!shared_ring<sample_t, spsc>::attach(name).valid(), "attach after remove fails");
+	check(!shared_ring<sample_t, spsc>::remove(name), "second remove fails");
+}
+
+void check_wrap(const char* name) {
+	shared_ring<sample_t, spsc>::remove(name);
+	shared_ring<sample_t, spsc> ring = shared_ring<sample_t, spsc>::create(name, 8);
+	sample_t values[8];
+	for (int i = 0; i < 8; ++i) {
+		values[i] = sample_t::createRaw(i);
+	}
+	check(ring.write(values, 6) == 6, "write into an empty ring");
+	check(ring.read(values, 5) == 5, "read back");
+	check(ring.write(values, 8) == 7, "write stops when the ring is full");
+
+	const ring_span<sample_t> s = ring.begin_read(8);
+	check(s.size() == 8 && s.first_size == 3 && s.second_size == 5, "span wraps around once");
+	bool ordered = s[0].getRaw() == 5;
+	for (std::size_t i = 1; i < s.size(); ++i) {
+		ordered = ordered && s[i].getRaw() == static_cast<int32_t>(i - 1);
+	}
+	check(ordered, "wrapped span reads in order");
+	ring.commit_read(s);
+	check(ring.size() == 0 && ring.begin_read(1).empty(), "ring drained");
+	shared_ring<sample_t, spsc>::remove(name);
+}
+
+//-----------------------------------------------------------------------------
+// PRODUCERS AND CONSUMERS
+//-----------------------------------------------------------------------------
+
+template <ring_kind KIND>
+void produce(const char* name, int producer, uint32_t count) {
+	shared_ring<sample_t, KIND> ring = shared_ring<sample_t, KIND>::attach(name);
+	if (!ring.valid()) {
+		_exit(1);
+	}
+	std::vector<sample_t> batch(97);
+	uint32_t sent = 0;
+	while (sent < count) {
+		// vary the batch size so spans wrap at every offset
+		const uint32_t n = std::min<uint32_t>(1 + sent % 97, count - sent);
+		for (uint32_t k = 0; k < n; ++k) {
+			batch[k] = sample_t::createRaw(encode(producer, sent + k));
+		}
+		uint32_t written = 0;
+		while (written < n) {
+			const std::size_t w = ring.write(batch.data() + written, n - written);
+			written += static_cast<uint32_t>(w);
+			if (w == 0) {
+				sched_yield();
+			}
+		}
+		sent += n;
+	}
+	_exit(0);
+}
+
+template <ring_kind KIND>
+void consume(const char* name, int producers, uint64_t total, tally* shared) {
+	shared_ring<sample_t, KIND> ring = shared_ring<sample_t, KIND>::attach(name);
+	if (!ring.valid()) {
+		_exit(1);
+	}
+	// spans of one consumer are reserved in ring order, so each producer's
+	// sequence numbers only increase
+	std::vector<int64_t> last(producers, -1);
+	uint64_t errors = 0;
+	while (shared->consumed.load() < total) {
+		const ring_span<sample_t> s = ring.begin_read(200);
+		if (s.empty()) {
+			sched_yield();
+			continue;
+		}
+		for (std::size_t k = 0; k < s.size(); ++k) {
+			const uint32_t raw = static_cast<uint32_t>(s[k].getRaw());
+			const int producer = static_cast<int>(raw >> 24);
+			const int64_t sequence = raw & 0xFFFFFF;
+			if (producer >= producers || sequence <= last[producer]) {
+				++errors;
+			} else {
+				last[producer] = sequence;
+			}
+		}
+		ring.commit_read(s);
+		shared->consumed += s.size();
+	}
+	shared->errors += errors;
+	_exit(0);
+}
+
+template <ring_kind KIND>
+void check_transfer(const char* name, int producers, int consumers, uint32_t per_producer, const char* what) {
+	shared_ring<sample_t, KIND>::remove(name);
+	shared_ring<sample_t, KIND> ring = shared_ring<sample_t, KIND>::create(name, 1000);
+	check(ring.valid(), what);
+	const uint64_t total = static_cast<uint64_t>(producers) * per_producer;
+
+	void* mapping = ::mmap(nullptr, sizeof(tally), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	tally* shared = new (mapping) tally();
+	shared->consumed = 0;
+	shared->errors = 0;
+
+	std::vector<pid_t> children;
+	for (int p = 0; p < producers; ++p) {
+		const pid_t pid = ::fork();
+		if (pid == 0) {
+			produce<KIND>(name, p, per_producer);
+		}
+		children.push_back(pid);
+	}
+	for (int c = 0; c < consumers; ++c) {
+		const pid_t pid = ::fork();
+		if (pid == 0) {
+			consume<KIND>(name, producers, total, shared);
+		}
+		children.push_back(pid);
+	}
+	bool exited = true;
+	for (std::size_t i = 0; i < children.size(); ++i) {
+		int status = 0;
+		::waitpid(children[i], &status, 0);
+		exited = exited && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+	}
+
+	std::printf("%s: %llu values, %llu out of order\n", what,
+		static_cast<unsigned long long>(shared->consumed.load()),
+		static_cast<unsigned long long>(shared->errors.load()));
+	check(exited, what);
+	check(shared->consumed.load() == total && shared->errors.load() == 0, what);
+	check(ring.size() == 0, what);
+	::munmap(mapping, sizeof(tally));
+	shared_ring<sample_t, KIND>::remove(name);
+}
+
+} // namespace
+
+int main() {
+	check_attach("/fxp_shm_test_attach");
+	check_wrap("/fxp_shm_test_wrap");
+	check_transfer<spsc>("/fxp_shm_test_spsc", 1, 1, 2000000, "spsc 1x1");
+	check_transfer<mpmc>("/fxp_shm_test_mpmc", 4, 1, 300000, "mpmc 4x1");
+	check_transfer<mpmc>("/fxp_shm_test_mpmc", 3, 3, 300000, "mpmc 3x3");
+	std::printf("%d failed\n", failures);
+	return failures;
+}
@@ -29,6 +29,7 @@
 #include <iomanip>
 #include <ostream>
 #include <stdint.h>
+#include <type_traits>
 
 #include "fixed_point_utils.hpp"
 
@@ -72,6 +73,16 @@ public:
 	static const raw_t one  = ((raw_t)1) << FRAC_BITS;
 	static const raw_t zero = ((raw_t)0) << FRAC_BITS;
 
+private:
+	/// The value of one in a floating point type
+	/** one itself overflows raw_t when INT_BITS is 1, 2^FRAC_BITS is computed
+	 *  on the unsigned integer type instead. */
+	template <typename real_t>
+	static real_t scale() {
+		typedef typename get_uint_with_length<INT_BITS + FRAC_BITS>::RESULT uraw_t;
+		return static_cast<real_t>(static_cast<uraw_t>(1) << FRAC_BITS);
+	}
+
 public:
 	//---------------------------------------------------------------------------
 	// constructors
@@ -87,15 +98,19 @@ public:
 	ufixed_point_t(const uint32_t value) : raw(static_cast<raw_t>(value) << FRAC_BITS) {}
 	ufixed_point_t(const int64_t value)  : raw(static_cast<raw_t>(value) << FRAC_BITS) {}
 	ufixed_point_t(const uint64_t value) : raw(static_cast<raw_t>(value) << FRAC_BITS) {}
-	ufixed_point_t(const long double value) : raw((raw_t)(value * one)) {}
-	ufixed_point_t(const double value)      : raw((raw_t)(value * one)) {}
-	ufixed_point_t(const float value)       : raw((raw_t)(value * one)) {}
+	ufixed_point_t(const long double value) : raw((raw_t)(value * scale<long double>())) {}
+	ufixed_point_t(const double value)      : raw((raw_t)(value * scale<double>())) {}
+	ufixed_point_t(const float value)       : raw((raw_t)(value * scale<float>())) {}
 	#if _FIXED_POINT_REDEFINE_INT_TYPES_
 	ufixed_point_t(const int value)         : raw(static_cast<raw_t>(value) << FRAC_BITS) {}
 	ufixed_point_t(const unsigned int value): raw(static_cast<raw_t>(value) << FRAC_BITS) {}
 	#endif
 
-	explicit ufixed_point_t() : raw(0) {}
+	/// Trivial default constructor, the value is left uninitialized
+	/** Together with the implicit copy and move operations this keeps the
+	 *  type trivial, so that arrays are copied with memmove. Value-initialize
+	 *  (e.g. ufixed_point_t<>()) to get zero. */
+	ufixed_point_t() = default;
 
 	static this_t createRaw(raw_t data) {
 		this_t val;
@@ -256,10 +271,13 @@ this_t operator*(const ufixed_point_t<INT_BITS2, FRAC_BITS2>& value) const
 	return extended_res.template convert<INT_BITS, FRAC_BITS>();
 }
 
+/// Multiplication with a scalar
+/** Integers multiply the raw value directly, other scalars are converted to
+ *  this_t first. */
 template <typename other_t>
 this_t operator*(const other_t& value) const
 {
-	return *this * this_t(value);
+	return mul_scalar(value, std::is_integral<other_t>());
 }
 
 this_t& operator*=(const this_t& value) {
@@ -279,7 +297,8 @@ this_t& operator*=(const ufixed_point_t<INT_BITS2, FRAC_BITS2>& value)
 template <typename other_t>
 this_t& operator*=(const other_t& value)
 {
-	return *this *= this_t(value);
+	raw = (*this * value).getRaw();
+	return *this;
 }
 
 
@@ -307,10 +326,15 @@ this_t operator/(const ufixed_point_t<INT_BITS2, FRAC_BITS2>& divisor) const
 	return tmp.template convert<INT_BITS, FRAC_BITS>();
 }
 
+/// Division by a scalar
+/** Integers divide the raw value directly, rounding towards zero as the
+ *  division by a fixed-point does. Dividing by a constant thus compiles to
+ *  a shift or a multiplication by its reciprocal. Other scalars are
+ *  converted to this_t first. */
 template <typename other_t>
 this_t operator/(const other_t& value) const
 {
-	return *this / this_t(value);
+	return div_scalar(value, std::is_integral<other_t>());
 }
 
 this_t& operator/=(const this_t& value) {
@@ -330,7 +354,83 @@ this_t& operator/=(const ufixed_point_t<INT_BITS2, FRAC_BITS2>& value)
 template <typename other_t>
 this_t& operator/=(const other_t& value)
 {
-	return *this /= this_t(value);
+	raw = (*this / value).getRaw();
+	return *this;
+}
+
+/// Multiplication by 2^shift
+this_t operator<<(const int shift) const
+{
+	return this_t::createRaw(static_cast<raw_t>(static_cast<wrap_t>(raw) << shift));
+}
+
+/// Division by 2^shift, rounding towards -inf
+this_t operator>>(const int shift) const
+{
+	return this_t::createRaw(raw >> shift);
+}
+
+this_t& operator<<=(const int shift)
+{
+	raw = static_cast<raw_t>(static_cast<wrap_t>(raw) << shift);
+	return *this;
+}
+
+this_t& operator>>=(const int shift)
+{
+	raw >>= shift;
+	return *this;
+}
+
+/// Move the radix point SHIFT bits to the left: same raw, value times 2^SHIFT
+template <uint16_t SHIFT>
+ufixed_point_t<INT_BITS + SHIFT, FRAC_BITS - SHIFT> LeftShift() const
+{
+	return this->template reinterpret<INT_BITS + SHIFT, FRAC_BITS - SHIFT>();
+}
+
+/// Move the radix point SHIFT bits to the right: same raw, value over 2^SHIFT
+template <uint16_t SHIFT>
+ufixed_point_t<INT_BITS - SHIFT, FRAC_BITS + SHIFT> RightShift() const
+{
+	return this->template reinterpret<INT_BITS - SHIFT, FRAC_BITS + SHIFT>();
+}
+
+private:
+/// raw_t, at least as wide as unsigned int so that it is not promoted to int
+typedef typename std::common_type<raw_t, unsigned int>::type wrap_t;
+
+/// Integer type wide enough for both raw_t and the scalar type other_t
+template <typename other_t>
+struct scalar_op {
+	typedef typename get_uint_with_length<
+		get_max<sizeof(raw_t) * 8, sizeof(other_t) * 8>::RESULT>::RESULT RESULT;
+};
+
+template <typename other_t>
+this_t mul_scalar(const other_t& value, std::true_type) const
+{
+	typedef typename std::common_type<typename scalar_op<other_t>::RESULT, unsigned int>::type op_t;
+	return this_t::createRaw(static_cast<raw_t>(static_cast<op_t>(raw) * static_cast<op_t>(value)));
+}
+
+template <typename other_t>
+this_t mul_scalar(const other_t& value, std::false_type) const
+{
+	return *this * this_t(value);
+}
+
+template <typename other_t>
+this_t div_scalar(const other_t& value, std::true_type) const
+{
+	typedef typename scalar_op<other_t>::RESULT op_t;
+	return this_t::createRaw(static_cast<raw_t>(static_cast<op_t>(raw) / static_cast<op_t>(value)));
+}
+
+template <typename other_t>
+this_t div_scalar(const other_t& value, std::false_type) const
+{
+	return *this / this_t(value);
 }
 
 //---------------------------------------------------------------------------
@@ -504,11 +604,7 @@ this_t& operator=(const ufixed_point_t<INT_BITS2, FRAC_BITS2>& value)
 	return *this;
 }
 
-this_t& operator=(const this_t& value)
-{
-	raw = value.getRaw();
-	return *this;
-}
+// The copy assignment is implicitly declared to keep the type trivial
 
 
 //---------------------------------------------------------------------------
@@ -532,19 +628,21 @@ std::ostream& emit(std::ostream& os) const
 //---------------------------------------------------------------------------
 
 /// Get the value as a floating point
-float getValueF() const { return static_cast<float>(raw)/one; }
+float getValueF() const { return static_cast<float>(raw)/scale<float>(); }
 
 /// Get the value as a floating point double precision
-double getValueFD() const { return static_cast<double>(raw)/one; }
+double getValueFD() const { return static_cast<double>(raw)/scale<double>(); }
 
 /// Get the value as a floating point quadruple precision
-long double getValueFLD() const { return static_cast<long double>(raw)/one; }
+long double getValueFLD() const { return static_cast<long double>(raw)/scale<long double>(); }
 
 /// Get the value truncated to an integer
 raw_t getValue() const { return static_cast<raw_t>(raw >> FRAC_BITS); }
 
-/// Get the closest integer value
-raw_t round() const { return static_cast<raw_t>(round(getValueF())); }
+/// Get the closest integer value, rounding half away from zero
+raw_t round() const {
+	return static_cast<raw_t>(round_fixed_point<raw_t, FRAC_BITS>::round(raw) >> FRAC_BITS);
+}
 
 //---------------------------------------------------------------------------
 // conversion